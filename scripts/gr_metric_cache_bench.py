@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+"""
+Benchmark of the cached Kerr-Schild metric (<coord>/cache_metric) using the gr_bondi
+(hydro) and gr_torus (MHD) problem generators.
+
+Each kernel in stationary GR needs the metric at cell centers or faces.  Without the
+cache it is recomputed (a few sqrt and divisions, and about 60 other flops for the metric
+and its inverse, several hundred flops for its derivatives); with the cache it is read
+from memory (20 Reals for the metric and inverse, 30 Reals for the derivatives).  For
+each problem this script prints the number of metric evaluations replaced by loads and
+the extra bytes read per cell and stage, and then runs both paths and reports the
+measured zone-cycles/cpu_second.  A speed-up with the cache indicates that the GR kernels
+are compute bound on the target, a slow-down that they are bandwidth bound.
+
+Usage (from the root of the repository):
+    python scripts/gr_metric_cache_bench.py [--build DIR] [--nlim N] [--nx N] [--nmb N]
+
+The executables are built in DIR/bondi (built-in pgens) and DIR/torus (with
+-D PROBLEM=gr_torus) if they do not exist yet.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+
+REAL_SIZE = 8
+NMETRIC = 20  # covariant and contravariant metric
+NDERIV = 30  # derivatives of covariant metric
+
+# metric evaluations (metric and inverse, derivatives) per cell and stage, by kernel
+KERNELS = {
+    "bondi": [("fluxes (3 faces)", 3, 0), ("CoordSrcTerms", 1, 1), ("ConsToPrim", 1, 0)],
+    "torus": [("fluxes (3 faces)", 3, 0), ("CornerE", 1, 0), ("CoordSrcTerms", 1, 1),
+              ("ConsToPrim", 1, 0)],
+}
+PROBLEMS = {
+    "bondi": ("inputs/tests/bondi.athinput", []),
+    "torus": ("inputs/grmhd/gr_fm_torus_sane_8_4.athinput", ["-D", "PROBLEM=gr_torus"]),
+}
+
+
+def build(build_dir, cmake_args):
+    """Build executable in build_dir unless it exists, return path to executable."""
+    exe = os.path.join(build_dir, "src", "athena")
+    if not os.path.isfile(exe):
+        subprocess.run(["cmake", "-S", ".", "-B", build_dir] + cmake_args, check=True)
+        subprocess.run(["make", "-C", build_dir, "-j", f"{os.cpu_count()}"], check=True)
+    return exe
+
+
+def run(exe, input_file, nx, nmb, nlim, cache):
+    """Run problem on uniform mesh and return zone-cycles/cpu_second."""
+    arguments = [
+        f"mesh/nx1={nx}", f"mesh/nx2={nx}", f"mesh/nx3={nx}",
+        f"meshblock/nx1={nmb}", f"meshblock/nx2={nmb}", f"meshblock/nx3={nmb}",
+        "mesh_refinement/refinement=none",
+        f"time/nlim={nlim}", "time/ndiag=-1",
+        "output1/dt=-1",
+        f"coord/cache_metric={'true' if cache else 'false'}",
+    ]
+    out = subprocess.run([exe, "-i", input_file] + arguments, check=True,
+                         capture_output=True, text=True).stdout
+    return float(re.search(r"zone-cycles/cpu_second = (\S+)", out).group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--build", default="build_metric_cache",
+                        help="parent directory of build directories")
+    parser.add_argument("--nx", type=int, default=64, help="cells per direction of mesh")
+    parser.add_argument("--nmb", type=int, default=32,
+                        help="cells per direction of MeshBlocks")
+    parser.add_argument("--nlim", type=int, default=10, help="number of cycles")
+    parser.add_argument("--problems", nargs="+", default=list(PROBLEMS),
+                        choices=list(PROBLEMS), help="problems to run")
+    args = parser.parse_args()
+
+    for prob in args.problems:
+        input_file, cmake_args = PROBLEMS[prob]
+        exe = build(os.path.join(args.build, prob), cmake_args)
+        nmet = sum(n for _, n, _ in KERNELS[prob])
+        nder = sum(n for _, _, n in KERNELS[prob])
+        nbytes = REAL_SIZE * (NMETRIC * nmet + NDERIV * nder)
+        print(f"{prob}:")
+        for name, n, nd in KERNELS[prob]:
+            print(f"  {name:20s} {n} metric, {nd} derivative evaluations/cell")
+        print(f"  cache reads {nbytes} bytes/cell/stage in place of {nmet} metric and "
+              f"{nder} derivative evaluations")
+        for cache in (False, True):
+            zcps = run(exe, input_file, args.nx, args.nmb, args.nlim, cache)
+            print(f"  cache_metric = {cache!s:5s} zone-cycles/cpu_second = {zcps:.4e}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+"""
+Benchmark of the fused Z4c update (<z4c>/fused_update) using the z4c_gauge_wave problem.
+
+For both the unfused and fused paths this script prints a model of the bytes of global
+memory moved per interior cell and RK stage, split by kernel, and then runs the gauge
+wave with each path and reports the measured zone-cycles/cpu_second.  The memory model
+counts one read or write of each variable a kernel touches, i.e. it assumes that the
+finite-difference stencils are served from cache.  The kernels that loop over ghost
+zones are weighted by the ratio of the number of cells with and without ghost zones.
+
+Usage (from the root of the repository):
+    python scripts/z4c_fused_update_bench.py [--build DIR] [--nx N] [--nmb N] [--nlim N]
+
+The executable is built with -D PROBLEM=z4c_gauge_wave in the given build directory if
+it does not exist yet.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+
+NZ4C = 22  # number of Z4c variables
+NSYM = 6  # number of components of a symmetric 3x3 tensor
+NADM = 1 + 2 * NSYM  # psi4, g_dd, K_dd
+INPUT = "inputs/z4c/awa/z4c_gauge_wave.athinput"
+INTEGRATORS = {"rk1": 1, "rk2": 2, "rk3": 3, "rk4": 4}
+
+
+def bytes_per_cell(fused, nx, ng, nstages, real_size=8):
+    """Return list of (kernel, bytes per interior cell per stage) for one path.
+
+    The algebraic constraints and the ADM conversion are only applied in the last stage
+    (as for a vacuum spacetime), so they are averaged over the stages.
+    """
+    ghost = ((nx + 2 * ng) ** 3 - nx**3) / nx**3  # ghost cells per interior cell
+    last = 1.0 / nstages  # fraction of stages that apply constraints
+    algc = 2 * 2 * NSYM  # read and write g_dd, A_dd
+    adm = (3 + 2 * NSYM) + NADM  # read chi, Khat, Theta, g_dd, A_dd; write ADM
+    if not fused:
+        kernels = [
+            ("CalcRHS", NZ4C + NZ4C),
+            ("K-O dissipation", NZ4C + 2 * NZ4C),
+            ("ExpRKUpdate", 3 * NZ4C + NZ4C),
+            ("AlgConstr", last * algc * (1.0 + ghost)),
+            ("Z4cToADM", last * adm * (1.0 + ghost)),
+        ]
+    else:
+        kernels = [
+            ("CalcRHS + dissipation", NZ4C + NZ4C),
+            ("ExpRKUpdate + AlgConstr + Z4cToADM", 3 * NZ4C + NZ4C + last * NADM),
+            ("AlgConstr (ghosts)", last * algc * ghost),
+            ("Z4cToADM (ghosts)", last * adm * ghost),
+        ]
+    return [(name, real_size * nvar) for name, nvar in kernels]
+
+
+def run(exe, nx, nmb, nlim, fused):
+    """Run gauge wave and return zone-cycles/cpu_second."""
+    arguments = [
+        f"mesh/nx1={nx}", f"mesh/nx2={nx}", f"mesh/nx3={nx}",
+        f"meshblock/nx1={nmb}", f"meshblock/nx2={nmb}", f"meshblock/nx3={nmb}",
+        f"time/nlim={nlim}", "time/ndiag=-1",
+        "output1/dt=-1", "output2/dt=-1",
+        f"z4c/fused_update={'true' if fused else 'false'}",
+    ]
+    out = subprocess.run([exe, "-i", INPUT] + arguments, check=True,
+                         capture_output=True, text=True).stdout
+    return float(re.search(r"zone-cycles/cpu_second = (\S+)", out).group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--build", default="build_gauge_wave",
+                        help="build directory for the z4c_gauge_wave executable")
+    parser.add_argument("--nx", type=int, default=64, help="cells per direction of mesh")
+    parser.add_argument("--nmb", type=int, default=32,
+                        help="cells per direction of MeshBlocks")
+    parser.add_argument("--nlim", type=int, default=20, help="number of cycles")
+    parser.add_argument("--nghost", type=int, default=2, help="ghost zones in input")
+    parser.add_argument("--integrator", default="rk4", choices=INTEGRATORS.keys(),
+                        help="integrator set in input")
+    args = parser.parse_args()
+
+    exe = os.path.join(args.build, "src", "athena")
+    if not os.path.isfile(exe):
+        subprocess.run(["cmake", "-S", ".", "-B", args.build,
+                        "-D", "PROBLEM=z4c_gauge_wave"], check=True)
+        subprocess.run(["make", "-C", args.build, "-j", f"{os.cpu_count()}"], check=True)
+
+    nstages = INTEGRATORS[args.integrator]
+    for fused in (False, True):
+        kernels = bytes_per_cell(fused, args.nmb, args.nghost, nstages)
+        print(f"fused_update = {fused}")
+        for name, nbytes in kernels:
+            print(f"  {name:40s} {nbytes:8.1f} bytes/cell")
+        print(f"  {'total':40s} {sum(b for _, b in kernels):8.1f} bytes/cell")
+        zcps = run(exe, args.nx, args.nmb, args.nlim, fused)
+        print(f"  zone-cycles/cpu_second = {zcps:.4e}")
+
+
+if __name__ == "__main__":
+    main()
@@ -34,6 +34,18 @@ using Real = double;
 
 #endif // SINGLE_PRECISION_ENABLED
 
+// storage type for the (memory-dominant) radiation intensities, fluxes, and tetrads.  With
+// mixed precision these are stored as floats, while all arithmetic is performed in Real
+
+#if RAD_MIXED_PRECISION_ENABLED
+#if SINGLE_PRECISION_ENABLED
+#error "RAD_MIXED_PRECISION_ENABLED requires SINGLE_PRECISION_ENABLED=0"
+#endif
+using RadReal = float;
+#else
+using RadReal = Real;
+#endif // RAD_MIXED_PRECISION_ENABLED
+
 //----------------------------------------------------------------------------------------
 // general purpose macros (never modified)
 
@@ -79,6 +79,24 @@ MeshBoundaryValues::MeshBoundaryValues(MeshBlockPack *pp, ParameterInput *pin, b
   // create unique communicators for variables and fluxes in this BoundaryValues object
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_vars);
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_flux);
+
+  // reallocate vectors of MPI requests when MeshBlockPool is resized with AMR.  All
+  // communications are complete at this point, so requests do not need to be copied.
+  pmy_pack->pmesh->pmb_pool->RegisterFunction([this, nnghbr](int nmb) {
+    for (int n=0; n<nnghbr; ++n) {
+      MeshBoundaryBuffer *pbuf[2] = {&(sendbuf[n]), &(recvbuf[n])};
+      for (auto buf : pbuf) {
+        delete [] buf->vars_req;
+        delete [] buf->flux_req;
+        buf->vars_req = new MPI_Request[nmb];
+        buf->flux_req = new MPI_Request[nmb];
+        for (int m=0; m<nmb; ++m) {
+          buf->vars_req[m] = MPI_REQUEST_NULL;
+          buf->flux_req[m] = MPI_REQUEST_NULL;
+        }
+      }
+    }
+  });
 #endif
 }
 
@@ -228,6 +246,16 @@ void MeshBoundaryValues::InitializeBuffers(const int nvar) {
     }
   }
 
+  // register buffers with MeshBlockPool so they are resized with AMR
+  auto &pool = pmy_pack->pmesh->pmb_pool;
+  int nnghbr = pmy_pack->pmb->nnghbr;
+  for (int n=0; n<nnghbr; ++n) {
+    pool->Register(sendbuf[n].vars);
+    pool->Register(sendbuf[n].flux);
+    pool->Register(recvbuf[n].vars);
+    pool->Register(recvbuf[n].flux);
+  }
+
   return;
 }
 
@@ -139,7 +139,8 @@ class MeshBoundaryValues {
   // BCs associated with various physics modules
   static void HydroBCs(MeshBlockPack *pp, DualArray2D<Real> uin, DvceArray5D<Real> u0);
   static void BFieldBCs(MeshBlockPack *pp, DualArray2D<Real> bin, DvceFaceFld4D<Real> b0);
-  static void RadiationBCs(MeshBlockPack *pp,DualArray2D<Real> iin,DvceArray5D<Real> i0);
+  static void RadiationBCs(MeshBlockPack *pp, DualArray2D<Real> iin,
+                           DvceArray5D<RadReal> i0);
   static void Z4cBCs(MeshBlockPack *pp, DualArray2D<Real> uin, DvceArray5D<Real> u0,
                      DvceArray5D<Real> coarse_u0);
 
@@ -163,17 +164,23 @@ class MeshBoundaryValuesCC : public MeshBoundaryValues {
   void InitRecvIndices(MeshBoundaryBuffer &b,int o1,int o2,int o3,int f1,int f2) override;
   TaskStatus InitFluxRecv(const int nvar) override;
 
-  // functions to communicate CC data
-  TaskStatus PackAndSendCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
-  TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  // functions to communicate CC data (templated on the value type T of the arrays, which
+  // is Real, or RadReal for radiation intensities; buffers always use Real)
+  template <typename T>
+  TaskStatus PackAndSendCC(DvceArray5D<T> &a, DvceArray5D<T> &ca);
+  template <typename T>
+  TaskStatus RecvAndUnpackCC(DvceArray5D<T> &a, DvceArray5D<T> &ca);
   // functions to communicate fluxes of CC data
-  TaskStatus PackAndSendFluxCC(DvceFaceFld5D<Real> &flx);
-  TaskStatus RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx);
+  template <typename T>
+  TaskStatus PackAndSendFluxCC(DvceFaceFld5D<T> &flx);
+  template <typename T>
+  TaskStatus RecvAndUnpackFluxCC(DvceFaceFld5D<T> &flx);
 
   // functions to prolongate conserved and primitive CC variables
-  void FillCoarseInBndryCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
-       bool is_z4c=false);
-  void ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, bool is_z4c=false);
+  template <typename T>
+  void FillCoarseInBndryCC(DvceArray5D<T> &a, DvceArray5D<T> &ca, bool is_z4c=false);
+  template <typename T>
+  void ProlongateCC(DvceArray5D<T> &a, DvceArray5D<T> &ca, bool is_z4c=false);
   void ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons, DvceArray5D<Real> &prim);
   void PrimToConsFineBndry(const DvceArray5D<Real> &prim, DvceArray5D<Real> &cons);
   void ConsToPrimCoarseBndry(const DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
@@ -38,8 +38,8 @@ MeshBoundaryValuesCC::MeshBoundaryValuesCC(MeshBlockPack *pp, ParameterInput *pi
 //! Input arrays must be 5D Kokkos View dimensioned (nmb, nvar, nx3, nx2, nx1)
 //! 5D Kokkos View of coarsened (restricted) array data also required with SMR/AMR
 
-TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
-                                               DvceArray5D<Real> &ca) {
+template <typename T>
+TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<T> &a, DvceArray5D<T> &ca) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -253,12 +253,20 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendCC(DvceArray5D<Real> &a,
   return TaskStatus::complete;
 }
 
+// function definitions for each template parameter
+template TaskStatus MeshBoundaryValuesCC::PackAndSendCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca);
+#if RAD_MIXED_PRECISION_ENABLED
+template TaskStatus MeshBoundaryValuesCC::PackAndSendCC<RadReal>(
+    DvceArray5D<RadReal> &a, DvceArray5D<RadReal> &ca);
+#endif
+
 //----------------------------------------------------------------------------------------
 // \!fn void RecvBuffers()
 // \brief Unpack boundary buffers
 
-TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
-                                                 DvceArray5D<Real> &ca) {
+template <typename T>
+TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<T> &a, DvceArray5D<T> &ca) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -408,3 +416,11 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
 
   return TaskStatus::complete;
 }
+
+// function definitions for each template parameter
+template TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca);
+#if RAD_MIXED_PRECISION_ENABLED
+template TaskStatus MeshBoundaryValuesCC::RecvAndUnpackCC<RadReal>(
+    DvceArray5D<RadReal> &a, DvceArray5D<RadReal> &ca);
+#endif
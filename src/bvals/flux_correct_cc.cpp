@@ -26,7 +26,8 @@
 //! MeshBlocks. Buffer data are then sent (via MPI) or copied directly for periodic or
 //! block boundaries.
 
-TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
+template <typename T>
+TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<T> &flx) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -192,11 +193,20 @@ TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC(DvceFaceFld5D<Real> &flx) {
   return TaskStatus::complete;
 }
 
+// function definitions for each template parameter
+template TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC<Real>(
+    DvceFaceFld5D<Real> &flx);
+#if RAD_MIXED_PRECISION_ENABLED
+template TaskStatus MeshBoundaryValuesCC::PackAndSendFluxCC<RadReal>(
+    DvceFaceFld5D<RadReal> &flx);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void RecvBuffers()
 //! \brief Unpack boundary buffers for flux correction of CC variables.
 
-TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx) {
+template <typename T>
+TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC(DvceFaceFld5D<T> &flx) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nnghbr = pmy_pack->pmb->nnghbr;
@@ -295,6 +305,14 @@ TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC(DvceFaceFld5D<Real> &flx) {
   return TaskStatus::complete;
 }
 
+// function definitions for each template parameter
+template TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC<Real>(
+    DvceFaceFld5D<Real> &flx);
+#if RAD_MIXED_PRECISION_ENABLED
+template TaskStatus MeshBoundaryValuesCC::RecvAndUnpackFluxCC<RadReal>(
+    DvceFaceFld5D<RadReal> &flx);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn  void BoundaryValuesCC::InitRecvFlux
 //! \brief Posts non-blocking receives (with MPI) for boundary communication of fluxes of
@@ -26,8 +26,9 @@
 //! by the prolongation interpolation stencil, data is restricted to coarse array in
 //! boundaries between MeshBlocks at the same level.
 
-void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
-                                               DvceArray5D<Real> &ca,
+template <typename T>
+void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<T> &a,
+                                               DvceArray5D<T> &ca,
                                                bool is_z4c) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
@@ -126,12 +127,21 @@ void MeshBoundaryValuesCC::FillCoarseInBndryCC(DvceArray5D<Real> &a,
   return;
 }
 
+// function definitions for each template parameter
+template void MeshBoundaryValuesCC::FillCoarseInBndryCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca, bool is_z4c);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshBoundaryValuesCC::FillCoarseInBndryCC<RadReal>(DvceArray5D<RadReal> &a,
+    DvceArray5D<RadReal> &ca, bool is_z4c);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void ProlongateCC()
 //! \brief Prolongate data at boundaries for cell-centered data.
 //! Code here is based on MeshRefinement::ProlongateCellCenteredValues() in C++ version
 
-void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+template <typename T>
+void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<T> &a, DvceArray5D<T> &ca,
     bool is_z4c) {
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
@@ -209,6 +219,14 @@ void MeshBoundaryValuesCC::ProlongateCC(DvceArray5D<Real> &a, DvceArray5D<Real>
   return;
 }
 
+// function definitions for each template parameter
+template void MeshBoundaryValuesCC::ProlongateCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca, bool is_z4c);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshBoundaryValuesCC::ProlongateCC<RadReal>(DvceArray5D<RadReal> &a,
+    DvceArray5D<RadReal> &ca, bool is_z4c);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void FillCoarseInBndryFC()
 //! \brief As in the case of cell-centered variables, to ensure that the coarse field is
@@ -40,18 +40,29 @@ ADM::ADM(MeshBlockPack *ppack, ParameterInput *pin):
 
   if (pmy_pack->pz4c == nullptr) {
     Kokkos::realloc(u_adm, nmb, nadm, ncells3, ncells2, ncells1);
-    adm.alpha.InitWithShallowSlice(u_adm, I_ADM_ALPHA);
-    adm.beta_u.InitWithShallowSlice(u_adm, I_ADM_BETAX, I_ADM_BETAZ);
   } else {
     // Lapse and shift are stored in the Z4c class
-    z4c::Z4c * pz4c = pmy_pack->pz4c;
     Kokkos::realloc(u_adm, nmb, nadm - 4, ncells3, ncells2, ncells1);
-    adm.alpha.InitWithShallowSlice(pz4c->u0, pz4c->I_Z4C_ALPHA);
-    adm.beta_u.InitWithShallowSlice(pz4c->u0, pz4c->I_Z4C_BETAX, pz4c->I_Z4C_BETAZ);
   }
-  adm.psi4.InitWithShallowSlice(u_adm, I_ADM_PSI4);
-  adm.g_dd.InitWithShallowSlice(u_adm, I_ADM_GXX, I_ADM_GZZ);
-  adm.vK_dd.InitWithShallowSlice(u_adm, I_ADM_KXX, I_ADM_KZZ);
+  auto set_slices = [this]() {
+    if (pmy_pack->pz4c == nullptr) {
+      adm.alpha.InitWithShallowSlice(u_adm, I_ADM_ALPHA);
+      adm.beta_u.InitWithShallowSlice(u_adm, I_ADM_BETAX, I_ADM_BETAZ);
+    } else {
+      z4c::Z4c * pz4c = pmy_pack->pz4c;
+      adm.alpha.InitWithShallowSlice(pz4c->u0, pz4c->I_Z4C_ALPHA);
+      adm.beta_u.InitWithShallowSlice(pz4c->u0, pz4c->I_Z4C_BETAX, pz4c->I_Z4C_BETAZ);
+    }
+    adm.psi4.InitWithShallowSlice(u_adm, I_ADM_PSI4);
+    adm.g_dd.InitWithShallowSlice(u_adm, I_ADM_GXX, I_ADM_GZZ);
+    adm.vK_dd.InitWithShallowSlice(u_adm, I_ADM_KXX, I_ADM_KZZ);
+  };
+  set_slices();
+
+  // slices must be reset whenever u_adm (or z4c::u0, which is registered before u_adm)
+  // is resized by MeshBlockPool with AMR
+  ppack->pmesh->pmb_pool->Register(u_adm);
+  ppack->pmesh->pmb_pool->RegisterFunction([set_slices](int n) {set_slices();});
 }
 
 //----------------------------------------------------------------------------------------
@@ -378,5 +378,92 @@ void ComputeMetricDerivatives(Real x, Real y, Real z, bool minkowski, Real a,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void StoreMetricAndInverse
+//! \brief stores 10 covariant and 10 contravariant components of metric in a single cell
+//!  of the array used to cache the metric (see <coord>/cache_metric)
+
+KOKKOS_INLINE_FUNCTION
+void StoreMetricAndInverse(const DvceArray5D<Real> &gcache,
+                           const int m, const int k, const int j, const int i,
+                           const Real glower[][4], const Real gupper[][4]) {
+  int n = 0;
+  for (int a=0; a<4; ++a) {
+    for (int b=a; b<4; ++b) {
+      gcache(m,n,   k,j,i) = glower[a][b];
+      gcache(m,n+10,k,j,i) = gupper[a][b];
+      ++n;
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void LoadMetricAndInverse
+//! \brief loads covariant and contravariant components of metric in a single cell from
+//!  the array used to cache the metric.  Replaces call to ComputeMetricAndInverse.
+
+KOKKOS_INLINE_FUNCTION
+void LoadMetricAndInverse(const DvceArray5D<Real> &gcache,
+                          const int m, const int k, const int j, const int i,
+                          Real glower[][4], Real gupper[][4]) {
+  int n = 0;
+  for (int a=0; a<4; ++a) {
+    for (int b=a; b<4; ++b) {
+      glower[a][b] = gcache(m,n,   k,j,i);
+      gupper[a][b] = gcache(m,n+10,k,j,i);
+      glower[b][a] = glower[a][b];
+      gupper[b][a] = gupper[a][b];
+      ++n;
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void StoreMetricDerivatives
+//! \brief stores 3x10 derivatives of covariant metric in a single cell of the array used
+//!  to cache the metric derivatives
+
+KOKKOS_INLINE_FUNCTION
+void StoreMetricDerivatives(const DvceArray5D<Real> &dgcache,
+                            const int m, const int k, const int j, const int i,
+                            const Real dg_dx1[][4], const Real dg_dx2[][4],
+                            const Real dg_dx3[][4]) {
+  int n = 0;
+  for (int a=0; a<4; ++a) {
+    for (int b=a; b<4; ++b) {
+      dgcache(m,n,   k,j,i) = dg_dx1[a][b];
+      dgcache(m,n+10,k,j,i) = dg_dx2[a][b];
+      dgcache(m,n+20,k,j,i) = dg_dx3[a][b];
+      ++n;
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void LoadMetricDerivatives
+//! \brief loads derivatives of covariant metric in a single cell from the array used to
+//!  cache the metric derivatives.  Replaces call to ComputeMetricDerivatives.
+
+KOKKOS_INLINE_FUNCTION
+void LoadMetricDerivatives(const DvceArray5D<Real> &dgcache,
+                           const int m, const int k, const int j, const int i,
+                           Real dg_dx1[][4], Real dg_dx2[][4], Real dg_dx3[][4]) {
+  int n = 0;
+  for (int a=0; a<4; ++a) {
+    for (int b=a; b<4; ++b) {
+      dg_dx1[a][b] = dgcache(m,n,   k,j,i);
+      dg_dx2[a][b] = dgcache(m,n+10,k,j,i);
+      dg_dx3[a][b] = dgcache(m,n+20,k,j,i);
+      dg_dx1[b][a] = dg_dx1[a][b];
+      dg_dx2[b][a] = dg_dx2[a][b];
+      dg_dx3[b][a] = dg_dx3[a][b];
+      ++n;
+    }
+  }
+  return;
+}
 
 #endif // COORDINATES_CARTESIAN_KS_HPP_
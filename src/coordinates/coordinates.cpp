@@ -91,6 +91,85 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
       }
     }
   }
+
+  // Optionally cache metric in stationary spacetimes.  Coordinates are rebuilt after AMR,
+  // so the cache is refreshed whenever MeshBlocks are created or moved.
+  if (is_general_relativistic) {
+    coord_data.cache_metric = pin->GetOrAddBoolean("coord","cache_metric",false);
+    if (coord_data.cache_metric) {
+      SetMetricCache();
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetMetricCache()
+//! \brief Computes and stores the covariant and contravariant metric at cell centers and
+//! faces, and derivatives of the metric at cell centers, over all cells including ghost
+//! zones.  Requires 20 values per cell at centers and on each of 3 faces, and 30 values
+//! per cell for derivatives (110 Reals per cell in total).
+
+void Coordinates::SetMetricCache() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is; int js = indcs.js; int ks = indcs.ks;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  int nmb = pmy_pack->nmb_thispack;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &flat = coord_data.is_minkowski;
+  auto &spin = coord_data.bh_spin;
+
+  Kokkos::realloc(coord_data.gcc,  nmb, 20, n3, n2, n1);
+  Kokkos::realloc(coord_data.gx1f, nmb, 20, n3, n2, n1+1);
+  Kokkos::realloc(coord_data.gx2f, nmb, 20, n3, n2+1, n1);
+  Kokkos::realloc(coord_data.gx3f, nmb, 20, n3+1, n2, n1);
+  Kokkos::realloc(coord_data.dgcc, nmb, 30, n3, n2, n1);
+  auto gcc_ = coord_data.gcc;
+  auto gx1f_ = coord_data.gx1f;
+  auto gx2f_ = coord_data.gx2f;
+  auto gx3f_ = coord_data.gx3f;
+  auto dgcc_ = coord_data.dgcc;
+
+  // loop includes one extra cell in each direction for the faces
+  par_for("set_metric_cache", DevExeSpace(), 0, (nmb-1), 0, n3, 0, n2, 0, n1,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    Real &x1min = size.d_view(m).x1min;
+    Real &x1max = size.d_view(m).x1max;
+    Real &x2min = size.d_view(m).x2min;
+    Real &x2max = size.d_view(m).x2max;
+    Real &x3min = size.d_view(m).x3min;
+    Real &x3max = size.d_view(m).x3max;
+    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+    Real glower[4][4], gupper[4][4];
+    if (k < n3 && j < n2 && i < n1) {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+      StoreMetricAndInverse(gcc_, m, k, j, i, glower, gupper);
+      Real dg_dx1[4][4], dg_dx2[4][4], dg_dx3[4][4];
+      ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+      StoreMetricDerivatives(dgcc_, m, k, j, i, dg_dx1, dg_dx2, dg_dx3);
+    }
+    if (k < n3 && j < n2) {
+      Real x1f = LeftEdgeX(i-is, indcs.nx1, x1min, x1max);
+      ComputeMetricAndInverse(x1f, x2v, x3v, flat, spin, glower, gupper);
+      StoreMetricAndInverse(gx1f_, m, k, j, i, glower, gupper);
+    }
+    if (k < n3 && i < n1) {
+      Real x2f = LeftEdgeX(j-js, indcs.nx2, x2min, x2max);
+      ComputeMetricAndInverse(x1v, x2f, x3v, flat, spin, glower, gupper);
+      StoreMetricAndInverse(gx2f_, m, k, j, i, glower, gupper);
+    }
+    if (j < n2 && i < n1) {
+      Real x3f = LeftEdgeX(k-ks, indcs.nx3, x3min, x3max);
+      ComputeMetricAndInverse(x1v, x2v, x3f, flat, spin, glower, gupper);
+      StoreMetricAndInverse(gx3f_, m, k, j, i, glower, gupper);
+    }
+  });
+  return;
 }
 
 //----------------------------------------------------------------------------------------
@@ -105,6 +184,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
   int js = indcs.js; int je = indcs.je;
   int ks = indcs.ks; int ke = indcs.ke;
   auto &size = pmy_pack->pmb->mb_size;
+  auto &coord = coord_data;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
 
@@ -127,7 +207,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (coord.cache_metric) {
+      LoadMetricAndInverse(coord.gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -164,7 +248,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
 
     // compute derivatives of metric.
     Real dg_dx1[4][4], dg_dx2[4][4], dg_dx3[4][4];
-    ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    if (coord.cache_metric) {
+      LoadMetricDerivatives(coord.dgcc, m, k, j, i, dg_dx1, dg_dx2, dg_dx3);
+    } else {
+      ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    }
 
     // Calculate source terms, exploiting symmetries
     Real s_1 = 0.0, s_2 = 0.0, s_3 = 0.0;
@@ -228,6 +316,7 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
   int js = indcs.js; int je = indcs.je;
   int ks = indcs.ks; int ke = indcs.ke;
   auto &size = pmy_pack->pmb->mb_size;
+  auto &coord = coord_data;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
 
@@ -250,7 +339,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (coord.cache_metric) {
+      LoadMetricAndInverse(coord.gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -308,7 +401,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
 
     // compute derivatives of metric.
     Real dg_dx1[4][4], dg_dx2[4][4], dg_dx3[4][4];
-    ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    if (coord.cache_metric) {
+      LoadMetricDerivatives(coord.dgcc, m, k, j, i, dg_dx1, dg_dx2, dg_dx3);
+    } else {
+      ComputeMetricDerivatives(x1v, x2v, x3v, flat, spin, dg_dx1, dg_dx2, dg_dx3);
+    }
 
     // Calculate source terms
     Real s_1 = 0.0, s_2 = 0.0, s_3 = 0.0;
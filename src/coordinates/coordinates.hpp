@@ -41,6 +41,13 @@ struct CoordData {
   Real flux_excise_r;              // reduce to first-order inside this radius
   ExcisionScheme excision_scheme;  // excision method
   Real excise_lapse;               // if excision_scheme = lapse, excise under this lapse
+
+  // metric cached at cell centers and faces (only allocated if cache_metric = true), used
+  // in place of ComputeMetricAndInverse/ComputeMetricDerivatives in the main kernels
+  bool cache_metric = false;
+  DvceArray5D<Real> gcc;                 // g_{mu nu} and g^{mu nu} at cell centers
+  DvceArray5D<Real> gx1f, gx2f, gx3f;    // g_{mu nu} and g^{mu nu} at faces
+  DvceArray5D<Real> dgcc;                // d_i g_{mu nu} at cell centers
 };
 
 //----------------------------------------------------------------------------------------
@@ -70,6 +77,7 @@ class Coordinates {
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const DvceArray5D<Real> &bcc,
                      const EOS_Data &eos, const Real dt, DvceArray5D<Real> &u0);
   void SetExcisionMasks(DvceArray4D<bool> &floor, DvceArray4D<bool> &flux);
+  void SetMetricCache();
 
   void UpdateExcisionMasks();
 
@@ -38,18 +38,6 @@ Real VL4Limiter(const Real a, const Real b, const Real c, const Real d) {
   return VanLeerLimiter(VanLeerLimiter(a,b),VanLeerLimiter(c,d));
 }
 
-//----------------------------------------------------------------------------------------
-//! \fn Real KappaTemp()
-//! \brief Temperature-dependent conductivity given by Parker (1953) and Spitzer (1962)
-KOKKOS_INLINE_FUNCTION
-Real KappaTemp(Real temp, Real ceiling) {
-  if (temp < 6.5e4) {
-    return 2.5e3 * pow(temp, 0.5);
-  } else {
-    return fmin(6e-7 * pow(temp, 2.5),ceiling);
-  }
-}
-
 //----------------------------------------------------------------------------------------
 //! \brief Conduction constructor
 // Note that the coefficient of thermal conduction, kappa, corresponds to conductivity,
@@ -401,7 +389,8 @@ void Conduction::TempDependentHeatFlux(const DvceArray5D<Real> &w0, const EOS_Da
 
 //----------------------------------------------------------------------------------------
 //! \fn void Conduction::NewTimeStep()
-//! \brief Compute new time step for thermal conduction.
+//! \brief Compute new time step for thermal conduction.  Hydro::NewTimeStep() and
+//! MHD::NewTimeStep() instead compute it with CondCellNewDt() in their own kernels.
 
 void Conduction::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_data) {
   if (sat_hflux == true) {
@@ -415,27 +404,8 @@ void Conduction::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
   const int nmkji = (pmy_pack->nmb_thispack)*nx3*nx2*nx1;
   const int nkji = nx3*nx2*nx1;
   const int nji  = nx2*nx1;
-  auto &w0_ = w0;
-  auto &multi_d = pmy_pack->pmesh->multi_d;
-  auto &three_d = pmy_pack->pmesh->three_d;
   auto &size = pmy_pack->pmb->mb_size;
-  const bool &use_e = eos_data.use_e;
-  Real gm1 = eos_data.gamma-1.0;
-  Real kappa0 = kappa;
-  bool tdepkappa = tdep_kappa;
-  Real kappaceil = kappa_ceiling;
-  Real fac;
-  if (pmy_pack->pmesh->three_d) {
-    fac = 1.0/6.0;
-  } else if (pmy_pack->pmesh->two_d) {
-    fac = 0.25;
-  } else {
-    fac = 0.5;
-  }
-
-  Real temp_unit = pmy_pack->punit->temperature_cgs();
-  Real kappa_unit = pmy_pack->punit->pressure_cgs()*pmy_pack->punit->velocity_cgs()*
-                    pmy_pack->punit->length_cgs()/pmy_pack->punit->temperature_cgs();
+  CondDtData cd = GetDtData(eos_data);
 
   dtnew = static_cast<Real>(std::numeric_limits<float>::max());
 
@@ -450,27 +420,42 @@ void Conduction::NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
     k += ks;
     j += js;
 
-    Real kappa_ = kappa0;
-    if (tdepkappa) {
-      Real temp = 1.0;
-      if (use_e) {
-        temp = w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*gm1;
-      } else {
-        temp = w0(m,ITM,k,j,i);
-      }
-      kappa_ = KappaTemp(temp*temp_unit,kappaceil)/kappa_unit;
-    }
-
-    min_dt = fmin(min_dt, SQR(size.d_view(m).dx1)/kappa_*w0_(m,IDN,k,j,i)/gm1);
-    if (multi_d) {
-      min_dt = fmin(min_dt, SQR(size.d_view(m).dx2)/kappa_*w0_(m,IDN,k,j,i)/gm1);
-    }
-    if (three_d) {
-      min_dt = fmin(min_dt, SQR(size.d_view(m).dx3)/kappa_*w0_(m,IDN,k,j,i)/gm1);
-    }
+    min_dt = fmin(min_dt, CondCellNewDt(cd, w0, m, k, j, i, size.d_view(m).dx1,
+                                        size.d_view(m).dx2, size.d_view(m).dx3));
   }, Kokkos::Min<Real>(dtnew));
 
-  dtnew *= fac;
+  dtnew *= cd.fac;
 
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn CondDtData Conduction::GetDtData()
+//! \brief Returns parameters needed by CondCellNewDt()
+
+CondDtData Conduction::GetDtData(const EOS_Data &eos_data) {
+  CondDtData cd;
+  cd.tdep_kappa = tdep_kappa;
+  cd.use_e = eos_data.use_e;
+  cd.multi_d = pmy_pack->pmesh->multi_d;
+  cd.three_d = pmy_pack->pmesh->three_d;
+  cd.kappa = kappa;
+  cd.kappa_ceiling = kappa_ceiling;
+  cd.gm1 = eos_data.gamma - 1.0;
+  // units are only needed (and only guaranteed to exist) for temperature-dependent kappa
+  cd.temp_unit = 1.0;
+  cd.kappa_unit = 1.0;
+  if (pmy_pack->punit != nullptr) {
+    cd.temp_unit = pmy_pack->punit->temperature_cgs();
+    cd.kappa_unit = pmy_pack->punit->pressure_cgs()*pmy_pack->punit->velocity_cgs()*
+                    pmy_pack->punit->length_cgs()/pmy_pack->punit->temperature_cgs();
+  }
+  if (pmy_pack->pmesh->three_d) {
+    cd.fac = 1.0/6.0;
+  } else if (pmy_pack->pmesh->two_d) {
+    cd.fac = 0.25;
+  } else {
+    cd.fac = 0.5;
+  }
+  return cd;
+}
@@ -14,6 +14,58 @@
 #include "athena.hpp"
 #include "parameter_input.hpp"
 
+//----------------------------------------------------------------------------------------
+//! \fn Real KappaTemp()
+//! \brief Temperature-dependent conductivity given by Parker (1953) and Spitzer (1962)
+KOKKOS_INLINE_FUNCTION
+Real KappaTemp(Real temp, Real ceiling) {
+  if (temp < 6.5e4) {
+    return 2.5e3 * pow(temp, 0.5);
+  } else {
+    return fmin(6e-7 * pow(temp, 2.5),ceiling);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \struct CondDtData
+//! \brief parameters needed to compute the conduction timestep in each cell with
+//! CondCellNewDt(), so that it can be evaluated inside the Hydro and MHD timestep kernels
+
+struct CondDtData {
+  bool tdep_kappa, use_e, multi_d, three_d;
+  Real kappa, kappa_ceiling, gm1, temp_unit, kappa_unit;
+  Real fac;  // timestep is fac*(minimum over cells of CondCellNewDt())
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn Real CondCellNewDt()
+//! \brief smallest dx^2/diffusivity in cell (m,k,j,i)
+
+KOKKOS_INLINE_FUNCTION
+Real CondCellNewDt(const CondDtData &cd, const DvceArray5D<Real> &w0, const int m,
+                   const int k, const int j, const int i, const Real dx1, const Real dx2,
+                   const Real dx3) {
+  Real kappa_ = cd.kappa;
+  if (cd.tdep_kappa) {
+    Real temp = 1.0;
+    if (cd.use_e) {
+      temp = w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*cd.gm1;
+    } else {
+      temp = w0(m,ITM,k,j,i);
+    }
+    kappa_ = KappaTemp(temp*cd.temp_unit,cd.kappa_ceiling)/cd.kappa_unit;
+  }
+
+  Real dt = SQR(dx1)/kappa_*w0(m,IDN,k,j,i)/cd.gm1;
+  if (cd.multi_d) {
+    dt = fmin(dt, SQR(dx2)/kappa_*w0(m,IDN,k,j,i)/cd.gm1);
+  }
+  if (cd.three_d) {
+    dt = fmin(dt, SQR(dx3)/kappa_*w0(m,IDN,k,j,i)/cd.gm1);
+  }
+  return dt;
+}
+
 //----------------------------------------------------------------------------------------
 //! \class Conduction
 //! \brief data and functions that implement thermal conduction in Hydro and MHD
@@ -38,6 +90,7 @@ class Conduction {
   void TempDependentHeatFlux(const DvceArray5D<Real> &w, const EOS_Data &eos,
                              DvceFaceFld5D<Real> &f);
   void NewTimeStep(const DvceArray5D<Real> &w, const EOS_Data &eos_data);
+  CondDtData GetDtData(const EOS_Data &eos_data);
 
  private:
   MeshBlockPack* pmy_pack;
@@ -9,7 +9,9 @@
 #include <iostream>
 #include <iomanip>    // std::setprecision()
 #include <limits>
+#include <memory>
 #include <algorithm>
+#include <cmath>
 #include <string> // string
 
 #include "athena.hpp"
@@ -23,6 +25,7 @@
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "ion-neutral/ion-neutral.hpp"
 #include "radiation/radiation.hpp"
+#include "gravity/gravity.hpp"
 #include "driver.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -59,6 +62,9 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
   tlim(-1.0),
   nlim(-1),
   ndiag(1),
+  sts_integrator("none"),
+  nsts_stages(0),
+  sts_dt(0.0),
   nmb_updated_(0),
   npart_updated_(0),
   lb_efficiency_(0),
@@ -81,6 +87,13 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
     }
   } // extra brace to limit scope of string
 
+  // construct profiler for TaskLists if requested
+  if (pin->DoesBlockExist("profiler")) {
+    if (pin->GetOrAddBoolean("profiler", "enable", true)) {
+      pprofiler = std::make_unique<TaskProfiler>(pin);
+    }
+  }
+
   // read <time> parameters controlling driver if run requires time-evolution
   if (time_evolution != TimeEvolution::tstatic) {
     integrator = pin->GetOrAddString("time", "integrator", "rk2");
@@ -276,6 +289,15 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
          << "Valid choices are [rk1,rk2,rk3,rk4,imex2,imex3]." << std::endl;
       exit(EXIT_FAILURE);
     }
+
+    // super-time-stepping (STS) of diffusion terms, see ExecuteSTS()
+    sts_integrator = pin->GetOrAddString("time", "sts_integrator", "none");
+    if ((sts_integrator != "none") && (sts_integrator != "rkl2")) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "sts_integrator=" << sts_integrator << " not implemented. "
+         << "Valid choices are [none,rkl2]." << std::endl;
+      exit(EXIT_FAILURE);
+    }
   }
 }
 
@@ -290,17 +312,65 @@ void Driver::ExecuteTaskList(Mesh *pm, std::string tl, int stage) {
   for (int p=0; p<(pm->nmb_packs_thisrank); ++p) {
     if (!(pmbp->tl_map[tl]->Empty())) {pmbp->tl_map[tl]->Reset();}
   }
+  if (pprofiler != nullptr) {pprofiler->BeginTaskList(tl, stage);}
   int npack_left = (pm->nmb_packs_thisrank);
   while (npack_left > 0) {
     if (pmbp->tl_map[tl]->Empty()) {
       npack_left--;
     } else {
       if (!pmbp->tl_map[tl]->IsComplete()) {
-        auto status = pmbp->tl_map[tl]->DoAvailable(this, stage);
+        auto status = pmbp->tl_map[tl]->DoAvailable(this, stage, pprofiler.get());
         if (status == TaskListStatus::complete) { npack_left--; }
       }
     }
   }
+  if (pprofiler != nullptr) {pprofiler->EndTaskList();}
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::ExecuteSTS()
+//! \brief Integrates the diffusion terms over time interval dt using the second-order
+//! Runge-Kutta-Legendre (RKL2) super-time-stepping method of Meyer, Balsara & Aslam
+//! (2014, JCP 257, 594).  The number of stages s is the smallest for which dt is within
+//! the stability limit dt <= dt_diff*(s^2+s-2)/4, where dt_diff is the explicit timestep
+//! of the diffusion terms.  Starting from Y_0=U, each stage j=1,...,s computes
+//!   Y_j = mu_j Y_{j-1} + nu_j Y_{j-2} + (1-mu_j-nu_j) Y_0
+//!       + mu_twid_j dt M(Y_{j-1}) + gam_twid_j dt M(Y_0)
+//! where M() is minus the divergence of the diffusive fluxes, by running the
+//! "before_sts", "sts", and "after_sts" TaskLists with stage=j.  Then U=Y_s.
+
+void Driver::ExecuteSTS(Mesh *pm, Real dt) {
+  Real ratio = dt/(pm->dt_diff);
+  nsts_stages = static_cast<int>(0.5*(std::sqrt(9.0 + 16.0*ratio) - 1.0)) + 1;
+  nsts_stages = std::max(nsts_stages, 2);
+  sts_dt = dt;
+
+  // weights of each stage, Meyer et al. (2014) eqs. 16-17
+  auto b = [](Real j) {return (j < 2.0)? 1.0/3.0 : (j*j + j - 2.0)/(2.0*j*(j + 1.0));};
+  Real s = static_cast<Real>(nsts_stages);
+  Real w1 = 4.0/(s*s + s - 2.0);
+  sts_mu.resize(nsts_stages);
+  sts_nu.resize(nsts_stages);
+  sts_mu_twid.resize(nsts_stages);
+  sts_gam_twid.resize(nsts_stages);
+  sts_mu[0] = 1.0;
+  sts_nu[0] = 0.0;
+  sts_mu_twid[0] = b(1.0)*w1;
+  sts_gam_twid[0] = 0.0;
+  for (int n=1; n<nsts_stages; ++n) {
+    Real j = static_cast<Real>(n + 1);
+    sts_mu[n] = ((2.0*j - 1.0)/j)*b(j)/b(j - 1.0);
+    sts_nu[n] = -((j - 1.0)/j)*b(j)/b(j - 2.0);
+    sts_mu_twid[n] = sts_mu[n]*w1;
+    sts_gam_twid[n] = -(1.0 - b(j - 1.0))*sts_mu_twid[n];
+  }
+
+  for (int stage=1; stage<=nsts_stages; ++stage) {
+    ExecuteTaskList(pm, "before_sts", stage);
+    ExecuteTaskList(pm, "sts", stage);
+    ExecuteTaskList(pm, "after_sts", stage);
+  }
   return;
 }
 
@@ -363,6 +433,11 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
     int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(impl_src, nimp_stages, nmb, 8, ncells3, ncells2, ncells1);
+    // MeshBlock is second index of impl_src, so register general resize function
+    pmesh->pmb_pool->RegisterFunction([this](int n) {
+      Kokkos::resize(impl_src, impl_src.extent(0), n, impl_src.extent(2),
+                     impl_src.extent(3), impl_src.extent(4), impl_src.extent(5));
+    });
   }
 
   return;
@@ -392,6 +467,10 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       if (global_variable::my_rank == 0) {OutputCycleDiagnostics(pmesh);}
 
       // Execute TaskLists
+      // With STS, diffusion terms are integrated over dt/2 before and after the time
+      // integrator (Strang splitting)
+      if (pmesh->use_sts) {ExecuteSTS(pmesh, 0.5*(pmesh->dt));}
+
       // Work before time integrator indicated by "0" in stage
       ExecuteTaskList(pmesh, "before_timeintegrator", 0);
 
@@ -399,11 +478,16 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       for (int stage=1; stage<=(nexp_stages); ++stage) {
         ExecuteTaskList(pmesh, "before_stagen", stage);
         ExecuteTaskList(pmesh, "stagen", stage);
+        // timesteps of physics modules are computed in last stage, so start the reduction
+        // of the new timestep over all ranks.  It is completed by Mesh::NewTimeStep()
+        // below, after outputs and AMR.
+        if (stage == nexp_stages) {pmesh->PostNewTimeStep();}
         ExecuteTaskList(pmesh, "after_stagen", stage);
       }
 
       // Work after time integrator indicated by "1" in stage
       ExecuteTaskList(pmesh, "after_timeintegrator", 1);
+      if (pmesh->use_sts) {ExecuteSTS(pmesh, 0.5*(pmesh->dt));}
 
       // Work outside of TaskLists:
       // increment time, ncycle, etc.
@@ -439,7 +523,7 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 
       // AMR
       if (pmesh->adaptive) {pmesh->pmr->AdaptiveMeshRefinement(this, pin);}
-      // compute new timestep AFTER all Meshblocks refined/derefined
+      // complete new timestep AFTER all Meshblocks refined/derefined
       pmesh->NewTimeStep(tlim);
 
       // Update wall clock time if needed.
@@ -514,8 +598,27 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       std::cout << "cpu time used  = " << exe_time << std::endl;
       std::cout << "zone-cycles/cpu_second = " << zcps << std::endl;
       std::cout << "particle-updates/cpu_second = " << pups << std::endl;
+
+      // Print cost of self-gravity solver
+      gravity::Gravity *pgrav = pmesh->pmb_pack->pgrav;
+      if ((pgrav != nullptr) && (pgrav->nsolve > 0)) {
+        std::cout << std::endl << "self-gravity solves = " << pgrav->nsolve
+                  << ", mean V-cycles/solve = "
+                  << static_cast<float>(pgrav->ncycle_total)/pgrav->nsolve << std::endl;
+        std::cout << "self-gravity cpu time = " << pgrav->solve_time << " ("
+                  << 100.0*pgrav->solve_time/exe_time << "% of total)" << std::endl;
+      }
+    }
+    // print high-water mark of MeshBlock storage on each rank (called by all ranks)
+    if (pmesh->adaptive) {
+      pmesh->pmb_pool->PrintDiagnostics();
     }
   }
+
+  // write TaskList profiles (called by all ranks)
+  if (pprofiler != nullptr) {
+    pprofiler->WriteOutput(pin->GetString("job", "basename"));
+  }
   return;
 }
 
@@ -15,10 +15,12 @@
 #include <ctime>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "parameter_input.hpp"
 #include "outputs/outputs.hpp"
 #include "pgen/pgen.hpp"
+#include "tasklist/task_profiler.hpp"
 
 //----------------------------------------------------------------------------------------
 //! \class Driver
@@ -45,11 +47,18 @@ class Driver {
   Real a_twid[4][4], a_impl;       // matrix elements for implicit stages in ImEx
   Real cfl_limit;                  // maximum CFL number for integrator
   Real gamma;                      // gamma value for the IMEX_new integrator
+  // variables for RKL2 super-time-stepping (STS) of diffusion terms
+  std::string sts_integrator;      // STS integrator name (none, rkl2)
+  int nsts_stages;                 // number of STS stages in current STS step
+  Real sts_dt;                     // timestep of current STS step
+  std::vector<Real> sts_mu, sts_nu, sts_mu_twid, sts_gam_twid;  // weights per STS stage
   Kokkos::Timer* pwall_clock_;     // timer for tracking the wall clock
   Real wall_time;
+  std::unique_ptr<TaskProfiler> pprofiler;  // optional profiler for TaskLists
 
   // functions
   void ExecuteTaskList(Mesh *pm, std::string tl, int stage);
+  void ExecuteSTS(Mesh *pm, Real dt);
   void Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool rflag);
   void Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
   void Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
@@ -0,0 +1,111 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file gravity.cpp
+//! \brief implements functions in Gravity class.  The potential is computed from the
+//! density at the start of each stage of the time integrator (in the "before_stagen"
+//! task list), and then used in the source terms added after the update in that stage.
+
+#include <iostream>
+#include <memory>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "hydro/hydro.hpp"
+#include "mhd/mhd.hpp"
+#include "multigrid/multigrid.hpp"
+#include "gravity.hpp"
+
+namespace gravity {
+//----------------------------------------------------------------------------------------
+// constructor, parses input file and initializes data structures and parameters
+
+Gravity::Gravity(MeshBlockPack *pp, ParameterInput *pin) :
+    pmy_pack(pp),
+    nsolve(0),
+    ncycle_total(0),
+    solve_time(0.0) {
+  four_pi_G = pin->GetReal("gravity", "four_pi_G");
+  pmg = new Multigrid(pp, pin, "gravity");
+  phi = pmg->u[0];
+
+  auto &indcs = pp->pmesh->mb_indcs;
+  ioff = indcs.ng - 1;
+  joff = (pp->pmesh->multi_d)? indcs.ng - 1 : 0;
+  koff = (pp->pmesh->three_d)? indcs.ng - 1 : 0;
+}
+
+//----------------------------------------------------------------------------------------
+// destructor
+
+Gravity::~Gravity() {
+  delete pmg;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::IncludeSolveTask()
+//! \brief includes task that solves for potential in the "before_stagen" task list.
+//! Called by MeshBlockPack::AddPhysics() function
+
+void Gravity::IncludeSolveTask(std::shared_ptr<TaskList> tl, TaskID start) {
+  tl->AddTask(&Gravity::SolvePotential, this, start, "Gravity::SolvePotential");
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Gravity::SolvePotential()
+//! \brief task that solves for potential using density at start of stage
+
+TaskStatus Gravity::SolvePotential(Driver *pdrive, int stage) {
+  Solve();
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Gravity::Solve()
+//! \brief sets source term 4 pi G rho (summed over hydro and MHD fluids) and solves for
+//! the potential.  With all boundaries periodic the mean density is subtracted (Jeans'
+//! swindle).  Can be called directly, e.g. in problem generators.
+
+void Gravity::Solve() {
+  Kokkos::Timer timer;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int io = ioff, jo = joff, ko = koff;
+  Real fpg = four_pi_G;
+  auto src = pmg->src[0];
+
+  Kokkos::deep_copy(DevExeSpace(), src, 0.0);
+  if (pmy_pack->phydro != nullptr) {
+    auto u0 = pmy_pack->phydro->u0;
+    par_for("grav_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      src(m,0,k-ko,j-jo,i-io) += fpg*u0(m,IDN,k,j,i);
+    });
+  }
+  if (pmy_pack->pmhd != nullptr) {
+    auto u0 = pmy_pack->pmhd->u0;
+    par_for("grav_src", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      src(m,0,k-ko,j-jo,i-io) += fpg*u0(m,IDN,k,j,i);
+    });
+  }
+
+  pmg->Solve();
+  // arrays in Multigrid may have been reallocated by MeshBlockPool with AMR
+  phi = pmg->u[0];
+
+  Kokkos::fence();
+  solve_time += timer.seconds();
+  nsolve++;
+  ncycle_total += pmg->niterations;
+  return;
+}
+
+} // namespace gravity
@@ -0,0 +1,51 @@
+#ifndef GRAVITY_GRAVITY_HPP_
+#define GRAVITY_GRAVITY_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file gravity.hpp
+//! \brief defines Gravity class, which computes the gravitational potential of the fluid
+//! by solving the Poisson equation Lap(phi) = 4 pi G rho with the Multigrid solver.  The
+//! resulting acceleration is added to the fluid by SourceTerms::SelfGravity()
+
+#include <memory>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "tasklist/task_list.hpp"
+
+class Multigrid;
+
+namespace gravity {
+
+//----------------------------------------------------------------------------------------
+//! \class Gravity
+
+class Gravity {
+ public:
+  Gravity(MeshBlockPack *pp, ParameterInput *pin);
+  ~Gravity();
+
+  Real four_pi_G;           // 4 pi G in code units
+  Multigrid *pmg;           // Poisson solver
+  DvceArray5D<Real> phi;    // potential, including one ghost cell in active directions
+  int ioff, joff, koff;     // phi(m,0,k-koff,j-joff,i-ioff) is at cell (k,j,i) of fluid
+
+  // diagnostics accumulated over all solves
+  int nsolve;               // number of solves
+  int ncycle_total;         // total number of V-cycles (excluding FMG)
+  double solve_time;        // wall-clock time spent in solves [s]
+
+  // functions
+  void IncludeSolveTask(std::shared_ptr<TaskList> tl, TaskID start);
+  TaskStatus SolvePotential(Driver *pdrive, int stage);
+  void Solve();
+
+ private:
+  MeshBlockPack *pmy_pack;  // ptr to MeshBlockPack containing this Gravity
+};
+
+} // namespace gravity
+#endif // GRAVITY_GRAVITY_HPP_
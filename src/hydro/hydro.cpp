@@ -34,6 +34,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     coarse_w0("cprim",1,1,1,1,1),
     u1("cons1",1,1,1,1,1),
     uflx("uflx",1,1,1,1,1),
+    u_sts("cons_sts",1,1,1,1,1),
+    du_sts("dcons_sts",1,1,1,1,1),
     utest("utest",1,1,1,1,1),
     fofc("fofc",1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
@@ -87,8 +89,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     pcond = nullptr;
   }
 
-  // Source terms (if needed)
-  if (pin->DoesBlockExist("hydro_srcterms")) {
+  // Source terms (if needed).  Self-gravity is applied as a source term.
+  if (pin->DoesBlockExist("hydro_srcterms") || pin->DoesBlockExist("gravity")) {
     psrc = new SourceTerms("hydro_srcterms", ppack, pin);
   }
 
@@ -106,6 +108,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(u0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
     Kokkos::realloc(w0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+    ppack->pmesh->pmb_pool->Register(u0);
+    ppack->pmesh->pmb_pool->Register(w0);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -116,6 +120,8 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_u0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
     Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    ppack->pmesh->pmb_pool->Register(coarse_u0);
+    ppack->pmesh->pmb_pool->Register(coarse_w0);
   }
 
   // allocate boundary buffers for conserved (cell-centered) variables
@@ -279,11 +285,23 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
       Kokkos::realloc(uflx.x1f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
       Kokkos::realloc(uflx.x2f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
       Kokkos::realloc(uflx.x3f, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      ppack->pmesh->pmb_pool->Register(u1);
+      ppack->pmesh->pmb_pool->Register(uflx);
+
+      // allocate registers used with super-time-stepping of diffusion terms
+      if (ppack->pmesh->use_sts) {
+        Kokkos::realloc(u_sts,  nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(du_sts, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+        ppack->pmesh->pmb_pool->Register(u_sts);
+        ppack->pmesh->pmb_pool->Register(du_sts);
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
         Kokkos::realloc(fofc,  nmb, ncells3, ncells2, ncells1);
         Kokkos::realloc(utest, nmb, nhydro, ncells3, ncells2, ncells1);
+        ppack->pmesh->pmb_pool->Register(fofc);
+        ppack->pmesh->pmb_pool->Register(utest);
       }
     }
   }
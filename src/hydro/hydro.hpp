@@ -57,6 +57,19 @@ struct HydroTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID sts_irecv;
+  TaskID sts_flux;
+  TaskID sts_sendf;
+  TaskID sts_recvf;
+  TaskID sts_updt;
+  TaskID sts_restu;
+  TaskID sts_sendu;
+  TaskID sts_recvu;
+  TaskID sts_bcs;
+  TaskID sts_prol;
+  TaskID sts_c2p;
+  TaskID sts_csend;
+  TaskID sts_crecv;
 };
 
 namespace hydro {
@@ -99,6 +112,10 @@ class Hydro {
   DvceFaceFld5D<Real> uflx;   // fluxes of conserved quantities on cell faces
   Real dtnew;
 
+  // following only used with super-time-stepping of diffusion terms
+  DvceArray5D<Real> u_sts;    // conserved variables at start of STS step (Y_0)
+  DvceArray5D<Real> du_sts;   // dt*M(Y_0), change due to diffusion at start of STS step
+
   // following used for FOFC
   DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
@@ -132,6 +149,10 @@ class Hydro {
   // ...in "after_stagen_tl" list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
+  // ...in "sts" list (super-time-stepping of diffusion terms)
+  TaskStatus STSFluxes(Driver *d, int stage);
+  TaskStatus STSUpdate(Driver *d, int stage);
+  TaskStatus STSConToPrim(Driver *d, int stage);
 
   // CalculateFluxes function templated over Riemann Solvers
   template <Hydro_RSolver T>
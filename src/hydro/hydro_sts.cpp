@@ -0,0 +1,130 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file hydro_sts.cpp
+//! \brief Task list functions for the super-time-stepping (STS) integration of diffusion
+//! terms (viscosity, thermal conduction) in Hydro.  The STS stages are run by
+//! Driver::ExecuteSTS() using the RKL2 weights stored in the Driver.  The register u1
+//! (unused outside of the stages of the time integrator) stores Y_{j-2}, while u_sts and
+//! du_sts store Y_0 and dt*M(Y_0).
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
+#include "hydro.hpp"
+
+namespace hydro {
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSFluxes
+//! \brief Computes fluxes of conserved variables due to diffusion terms only
+
+TaskStatus Hydro::STSFluxes(Driver *pdrive, int stage) {
+  Kokkos::deep_copy(DevExeSpace(), uflx.x1f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x2f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x3f, 0.0);
+  if (pvisc != nullptr) {
+    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+  }
+  if (pcond != nullptr) {
+    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSUpdate
+//! \brief Updates conserved variables for one stage of the RKL2 STS integrator, see
+//! Driver::ExecuteSTS()
+
+TaskStatus Hydro::STSUpdate(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  bool first_stage = (stage == 1);
+  Real mu = pdrive->sts_mu[stage-1];
+  Real nu = pdrive->sts_nu[stage-1];
+  Real mu_twid = pdrive->sts_mu_twid[stage-1];
+  Real gam_twid = pdrive->sts_gam_twid[stage-1];
+  Real dt = pdrive->sts_dt;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nvar = nhydro + nscalars;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto us_ = u_sts;
+  auto dus_ = du_sts;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
+  int scr_level = 0;
+  size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
+
+  par_for_outer("h_sts",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
+
+    // compute dF1/dx1
+    par_for_inner(member, is, ie, [&](const int i) {
+      divf(i) = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+    });
+    member.team_barrier();
+
+    // Add dF2/dx2
+    if (multi_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      });
+      member.team_barrier();
+    }
+
+    // Add dF3/dx3
+    if (three_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      });
+      member.team_barrier();
+    }
+
+    par_for_inner(member, is, ie, [&](const int i) {
+      Real du = -dt*divf(i);
+      Real y = u0_(m,n,k,j,i);
+      if (first_stage) {
+        us_(m,n,k,j,i) = y;
+        dus_(m,n,k,j,i) = du;
+        u0_(m,n,k,j,i) = y + mu_twid*du;
+      } else {
+        u0_(m,n,k,j,i) = mu*y + nu*u1_(m,n,k,j,i) + (1.0 - mu - nu)*us_(m,n,k,j,i)
+                         + mu_twid*du + gam_twid*dus_(m,n,k,j,i);
+      }
+      u1_(m,n,k,j,i) = y;
+    });
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus Hydro::STSConToPrim
+//! \brief Computes primitives over entire mesh (including gz) after each STS stage.
+//! Differs from ConToPrim() only in that no operator split source terms are applied.
+
+TaskStatus Hydro::STSConToPrim(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1m1 = indcs.nx1 + 2*ng - 1;
+  int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
+  int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
+  peos->ConsToPrim(u0, w0, false, 0, n1m1, 0, n2m1, 0, n3m1);
+  return TaskStatus::complete;
+}
+} // namespace hydro
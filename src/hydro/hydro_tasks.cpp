@@ -49,32 +49,91 @@ void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>>
   TaskID none(0);
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none,
+                                          "Hydro::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr);
-  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr);
-  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none,
+                                       "Hydro::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu,
+                                       "Hydro::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux,
+                                       "Hydro::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf,
+                                       "Hydro::RecvFlux");
+  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf,
+                                       "Hydro::RKUpdate");
+  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt,
+                                       "Hydro::HydroSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms,
+                                       "Hydro::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa,
+                                       "Hydro::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa,
+                                       "Hydro::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu,
+                                       "Hydro::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu,
+                                       "Hydro::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu,
+                                       "Hydro::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr,
+                                       "Hydro::RecvU_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr,
+                                       "Hydro::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs,
+                                       "Hydro::Prolongate");
+  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol,
+                                       "Hydro::ConToPrim");
+  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p,
+                                       "Hydro::NewTimeStep");
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none,
+                                         "Hydro::ClearSend");
   // although RecvFlux/U functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend,
+                                         "Hydro::ClearRecv");
+
+  // assemble "before_sts", "sts", and "after_sts" task lists used to integrate
+  // diffusion terms with super-time-stepping.  See Driver::ExecuteSTS()
+  if (pmy_pack->pmesh->use_sts) {
+    if ((porb_u != nullptr) || (psbox_u != nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Super-time-stepping cannot be used with shearing box"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    id.sts_irecv = tl["before_sts"]->AddTask(&Hydro::InitRecv, this, none,
+                                             "Hydro::InitRecv");
+
+    id.sts_flux  = tl["sts"]->AddTask(&Hydro::STSFluxes, this, none,
+                                      "Hydro::STSFluxes");
+    id.sts_sendf = tl["sts"]->AddTask(&Hydro::SendFlux, this, id.sts_flux,
+                                      "Hydro::SendFlux");
+    id.sts_recvf = tl["sts"]->AddTask(&Hydro::RecvFlux, this, id.sts_sendf,
+                                      "Hydro::RecvFlux");
+    id.sts_updt  = tl["sts"]->AddTask(&Hydro::STSUpdate, this, id.sts_recvf,
+                                      "Hydro::STSUpdate");
+    id.sts_restu = tl["sts"]->AddTask(&Hydro::RestrictU, this, id.sts_updt,
+                                      "Hydro::RestrictU");
+    id.sts_sendu = tl["sts"]->AddTask(&Hydro::SendU, this, id.sts_restu,
+                                      "Hydro::SendU");
+    id.sts_recvu = tl["sts"]->AddTask(&Hydro::RecvU, this, id.sts_sendu,
+                                      "Hydro::RecvU");
+    id.sts_bcs   = tl["sts"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.sts_recvu,
+                                      "Hydro::ApplyPhysicalBCs");
+    id.sts_prol  = tl["sts"]->AddTask(&Hydro::Prolongate, this, id.sts_bcs,
+                                      "Hydro::Prolongate");
+    id.sts_c2p   = tl["sts"]->AddTask(&Hydro::STSConToPrim, this, id.sts_prol,
+                                      "Hydro::STSConToPrim");
+
+    id.sts_csend = tl["after_sts"]->AddTask(&Hydro::ClearSend, this, none,
+                                            "Hydro::ClearSend");
+    id.sts_crecv = tl["after_sts"]->AddTask(&Hydro::ClearRecv, this, id.sts_csend,
+                                            "Hydro::ClearRecv");
+  }
 
   return;
 }
@@ -180,12 +239,14 @@ TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<Hydro_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
-  }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  // Add viscous, heat-flux, etc fluxes (unless integrated separately with STS)
+  if (!(pmy_pack->pmesh->use_sts)) {
+    if (pvisc != nullptr) {
+      pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+    }
+    if (pcond != nullptr) {
+      pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+    }
   }
 
   // call FOFC if necessary
@@ -398,6 +459,10 @@ TaskStatus Hydro::ConToPrim(Driver *pdrive, int stage) {
   int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
   int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
   peos->ConsToPrim(u0, w0, false, 0, n1m1, 0, n2m1, 0, n3m1);
+  // exact ISM cooling is operator split, and applied once per step after the last stage
+  if ((psrc != nullptr) && psrc->ism_cooling_exact && (stage == pdrive->nexp_stages)) {
+    psrc->ISMCoolingExact(w0, peos->eos_data, pmy_pack->pmesh->dt, u0);
+  }
   return TaskStatus::complete;
 }
 
@@ -36,6 +36,9 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
   int is = indcs.is;
   int js = indcs.js;
   int ks = indcs.ks;
+  // metric cached at faces normal to the direction of the flux
+  const DvceArray5D<Real> &gface = (ivx == IVX) ? coord.gx1f :
+                                   ((ivx == IVY) ? coord.gx2f : coord.gx3f);
   par_for_inner(member, il, iu, [&](const int i) {
     // References to left primitives
     Real &wl_idn=wl(IDN,i);
@@ -75,7 +78,11 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (coord.cache_metric) {
+      LoadMetricAndInverse(gface, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Calculate 4-velocity in left state (contravariant compt)
     Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
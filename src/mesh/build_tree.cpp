@@ -267,34 +267,9 @@ void Mesh::BuildTreeFromScratch(ParameterInput *pin) {
   pmb_pack->AddMeshBlocks(pin);
   pmb_pack->pmb->SetNeighbors(ptree, rank_eachmb);
 
-  // Fix maximum number of MeshBlocks per rank with AMR
-  nmb_maxperrank = nmb_thisrank;
-  if (adaptive) {
-    if (pin->DoesParameterExist("mesh_refinement", "max_nmb_per_rank")) {
-      nmb_maxperrank = pin->GetReal("mesh_refinement", "max_nmb_per_rank");
-      if (nmb_maxperrank < nmb_thisrank) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "On rank=" << global_variable::my_rank << " Root grid requires "
-          << "more MeshBlocks (nmb_thisrank=" << nmb_thisrank << ") than specified by "
-          << "<mesh_refinement>/max_nmb_per_rank=" << nmb_maxperrank << std::endl;
-        std::exit(EXIT_FAILURE);
-      }
-    } else {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "With AMR maximum number of MeshBlocks per rank must be "
-        << "specified in input file using <mesh_refinement>/max_nmb_per_rank"
-        << std::endl;
-      std::exit(EXIT_FAILURE);
-    }
-  }
-#if MPI_PARALLEL_ENABLED
-  if (nmb_maxperrank > (1 << (NUM_BITS_LID))) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-      << "Maximum number of MeshBlocks per rank cannot exceed 2^(NUM_BITS_LID) due to MPI"
-      << " tag limits" << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
-#endif
+  // Create storage pool for per-MeshBlock arrays.  This sets the number of MeshBlock
+  // slots allocated on each rank (nmb_maxperrank), which grows/shrinks with AMR.
+  pmb_pool = new MeshBlockPool(this, pin);
 
   // Create new MeshRefinement object with either SMR or AMR (SMR needs Restrict fns)
   if (multilevel) {
@@ -478,26 +453,9 @@ void Mesh::BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile,
   pmb_pack->AddMeshBlocks(pin);
   pmb_pack->pmb->SetNeighbors(ptree, rank_eachmb);
 
-  // Fix maximum number of MeshBlocks per rank with AMR
-  nmb_maxperrank = nmb_thisrank;
-  if (adaptive) {
-    if (pin->DoesParameterExist("mesh_refinement", "max_nmb_per_rank")) {
-      nmb_maxperrank = pin->GetReal("mesh_refinement", "max_nmb_per_rank");
-      if (nmb_maxperrank < nmb_thisrank) {
-        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-          << std::endl << "On rank=" << global_variable::my_rank << " Root grid requires "
-          << "more MeshBlocks (nmb_thisrank=" << nmb_thisrank << ") than specified by "
-          << "<mesh_refinement>/max_nmb_per_rank=" << nmb_maxperrank << std::endl;
-        std::exit(EXIT_FAILURE);
-      }
-    } else {
-      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-        << std::endl << "With AMR maximum number of MeshBlocks per rank must be "
-        << "specified in input file using <mesh_refinement>/max_nmb_per_rank"
-        << std::endl;
-      std::exit(EXIT_FAILURE);
-    }
-  }
+  // Create storage pool for per-MeshBlock arrays.  This sets the number of MeshBlock
+  // slots allocated on each rank (nmb_maxperrank), which grows/shrinks with AMR.
+  pmb_pool = new MeshBlockPool(this, pin);
 
   // Create new MeshRefinement object with either SMR or AMR (SMR needs Restrict fns)
   if (multilevel) {
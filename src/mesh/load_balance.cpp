@@ -11,6 +11,7 @@
 #include <limits> // numeric_limits<>
 #include <algorithm> // max
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -34,17 +35,56 @@
 //!         nlist = number of MBs on each rank (array of length nrank)
 //! With multiple ranks in MPI, this function is needed even on a uniform mesh and not
 //! just for SMR/AMR, which is why it is part of the Mesh and not MeshRefinement class.
+//! The partition is computed using the strategy set by <mesh_refinement>/load_balancing.
+//! In every case each rank stores a contiguous range of gids along the Z-ordered list.
 
 void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb) {
   float min_cost = std::numeric_limits<float>::max();
-  float max_cost = 0.0, totalcost = 0.0;
-  // find min/max and total cost in clist
+  float max_cost = 0.0;
+  // find min/max cost in clist
   for (int i=0; i<nb; i++) {
-    totalcost += clist[i];
     min_cost = std::min(min_cost,clist[i]);
     max_cost = std::max(max_cost,clist[i]);
   }
 
+  if (lb_strategy == LoadBalanceStrategy::comm_volume) {
+    PartitionByCommVolume(clist, rlist, nb);
+  } else {
+    PartitionByCost(clist, rlist, nb);
+  }
+
+  slist[0] = 0;
+  int j = 0;
+  for (int i=1; i<nb; i++) { // make the list of nbstart and nblocks
+    if (rlist[i] != rlist[i-1]) {
+      nlist[j] = i-slist[j];
+      slist[++j] = i;
+    }
+  }
+  nlist[j] = nb-slist[j];
+
+#if MPI_PARALLEL_ENABLED
+  if (nb % global_variable::nranks != 0
+     && !adaptive && max_cost == min_cost && global_variable::my_rank == 0) {
+    std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Number of MeshBlocks cannot be divided evenly by number of MPI ranks. "
+              << "This will result in poor load balancing." << std::endl;
+  }
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::PartitionByCost(float *clist, int *rlist, int nb)
+//! \brief Default partition: splits Z-ordered list of MeshBlocks into contiguous chunks
+//! of (nearly) equal cost, filling ranks starting from the last one.
+
+void Mesh::PartitionByCost(float *clist, int *rlist, int nb) {
+  float totalcost = 0.0;
+  for (int i=0; i<nb; i++) {
+    totalcost += clist[i];
+  }
+
   int j = (global_variable::nranks) - 1;
   float targetcost = totalcost/global_variable::nranks;
   float mycost = 0.0;
@@ -66,24 +106,151 @@ void Mesh::LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb)
       targetcost = totalcost/(j+1);
     }
   }
-  slist[0] = 0;
-  j = 0;
-  for (int i=1; i<nb; i++) { // make the list of nbstart and nblocks
-    if (rlist[i] != rlist[i-1]) {
-      nlist[j] = i-slist[j];
-      slist[++j] = i;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::PartitionByCommVolume(float *clist, int *rlist, int nb)
+//! \brief Partition that minimizes a combined compute + ghost-exchange cost model.
+//! Starting from the cost-only partition, the position of each cut along the Z-ordered
+//! list of MeshBlocks is moved to minimize
+//!   max(work on the two ranks sharing the cut) + (ghost cells exchanged across the cut)
+//! where work is measured in cell updates, and ghost cells are weighted by lb_comm_weight
+//! and (for ranks on different nodes) lb_offnode_weight.  Cuts may only move so long as
+//! the work on each rank stays within a fraction lb_tolerance of the mean.
+//! MeshBlocks remain ordered by gid, since the AMR and restart machinery relies on
+//! MeshBlocks being Z-ordered and each rank storing a contiguous range of gids.
+
+void Mesh::PartitionByCommVolume(float *clist, int *rlist, int nb) {
+  PartitionByCost(clist, rlist, nb);
+  int nranks = global_variable::nranks;
+  if (nranks == 1) return;
+
+  // starting gid of MeshBlocks on each rank from initial partition
+  std::vector<int> start(nranks+1);
+  start[0] = 0;
+  start[nranks] = nb;
+  for (int i=1; i<nb; i++) {
+    if (rlist[i] != rlist[i-1]) {start[rlist[i]] = i;}
+  }
+
+  // running sum of work (in cell updates) along the list of MeshBlocks
+  float ncells_mb = static_cast<float>(NumberOfMeshBlockCells());
+  std::vector<double> work(nb+1);
+  work[0] = 0.0;
+  for (int i=0; i<nb; i++) {
+    work[i+1] = work[i] + ncells_mb*clist[i];
+  }
+  double max_work = (1.0 + lb_tolerance)*work[nb]/nranks;
+
+  // number of face cells crossing a cut placed before MeshBlock p, for every p.  Face
+  // between MBs a<b is crossed by all cuts with a < p <= b.
+  std::vector<MeshBlockFace> faces;
+  FindMeshBlockFaces(faces);
+  std::vector<double> ncross(nb+1, 0.0);
+  for (auto &f : faces) {
+    ncross[std::min(f.gida,f.gidb)+1] += f.ncells;
+    ncross[std::max(f.gida,f.gidb)+1] -= f.ncells;
+  }
+  for (int p=1; p<=nb; p++) {
+    ncross[p] += ncross[p-1];
+  }
+
+  // sweep over cuts, moving each to minimize local cost with neighboring cuts fixed
+  double ghost_weight = lb_comm_weight*static_cast<double>(mb_indcs.ng);
+  for (int iter=0; iter<2; ++iter) {
+    for (int r=1; r<nranks; ++r) {
+      double weight = ghost_weight;
+      if (node_eachrank[r-1] != node_eachrank[r]) {weight *= lb_offnode_weight;}
+      int best_p = start[r];
+      double best_cost = std::numeric_limits<double>::max();
+      for (int p=start[r-1]+1; p<start[r+1]; ++p) {
+        double wl = work[p] - work[start[r-1]];
+        double wr = work[start[r+1]] - work[p];
+        // only consider cuts which keep both ranks within tolerance (or initial cut)
+        if ((wl > max_work || wr > max_work) && p != start[r]) continue;
+        double cost = std::max(wl,wr) + weight*ncross[p];
+        if (cost < best_cost || (cost == best_cost && p == start[r])) {
+          best_cost = cost;
+          best_p = p;
+        }
+      }
+      start[r] = best_p;
     }
   }
-  nlist[j] = nb-slist[j];
 
-#if MPI_PARALLEL_ENABLED
-  if (nb % global_variable::nranks != 0
-     && !adaptive && max_cost == min_cost && global_variable::my_rank == 0) {
-    std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
-              << "Number of MeshBlocks cannot be divided evenly by number of MPI ranks. "
-              << "This will result in poor load balancing." << std::endl;
+  for (int r=0; r<nranks; ++r) {
+    for (int i=start[r]; i<start[r+1]; ++i) {rlist[i] = r;}
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::FindMeshBlockFaces(std::vector<MeshBlockFace> &faces)
+//! \brief Returns list of all faces shared by two MeshBlocks in the current tree, along
+//! with the number of cells on each face.  Only face neighbors are included; edges and
+//! corners contribute little to the volume of ghost-zone data.  At fine/coarse
+//! boundaries the face is stored once (from the finer MB), using # of fine cells.
+
+void Mesh::FindMeshBlockFaces(std::vector<MeshBlockFace> &faces) {
+  faces.clear();
+  float nface[3];
+  nface[0] = static_cast<float>(mb_indcs.nx2*mb_indcs.nx3);
+  nface[1] = static_cast<float>(mb_indcs.nx1*mb_indcs.nx3);
+  nface[2] = static_cast<float>(mb_indcs.nx1*mb_indcs.nx2);
+  int ndim = 1;
+  if (two_d) {ndim = 2;}
+  if (three_d) {ndim = 3;}
+
+  // walk tree (depth-first) to find every leaf
+  std::vector<MeshBlockTree*> stack;
+  stack.push_back(ptree.get());
+  while (!stack.empty()) {
+    MeshBlockTree *bt = stack.back();
+    stack.pop_back();
+    if (bt->pleaf_ != nullptr) {
+      for (int n=0; n<MeshBlockTree::nleaf_; ++n) {
+        if (bt->pleaf_[n] != nullptr) {stack.push_back(bt->pleaf_[n]);}
+      }
+      continue;
+    }
+    // bt is a leaf (MeshBlock), search for neighbors across upper and lower faces
+    for (int dir=0; dir<ndim; ++dir) {
+      for (int ox=-1; ox<=1; ox+=2) {
+        MeshBlockTree *nt = ptree->FindNeighbor(bt->lloc_, ((dir==0)? ox : 0),
+                              ((dir==1)? ox : 0), ((dir==2)? ox : 0), true);
+        if (nt == nullptr || nt->pleaf_ != nullptr) continue;  // boundary, or finer MB
+        if (nt->gid_ == bt->gid_) continue;                     // periodic self
+        // store faces with MB at same level only once
+        if (nt->lloc_.level == bt->lloc_.level && nt->gid_ < bt->gid_) continue;
+        MeshBlockFace f;
+        f.gida = bt->gid_;
+        f.gidb = nt->gid_;
+        f.ncells = nface[dir];
+        faces.push_back(f);
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::CutSurface()
+//! \brief Returns the total number of face cells shared by MeshBlocks on different ranks
+//! (ncut), and the number of these shared by MeshBlocks on different nodes (noffnode),
+//! for MeshBlocks distributed across ranks as given by rlist.
+
+void Mesh::CutSurface(int *rlist, const std::vector<MeshBlockFace> &faces, float &ncut,
+                      float &noffnode) {
+  ncut = 0.0;
+  noffnode = 0.0;
+  for (auto &f : faces) {
+    int ra = rlist[f.gida], rb = rlist[f.gidb];
+    if (ra != rb) {
+      ncut += f.ncells;
+      if (node_eachrank[ra] != node_eachrank[rb]) {noffnode += f.ncells;}
+    }
   }
-#endif
   return;
 }
 
@@ -637,7 +804,8 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
 //! Equivalent to PrepareSendSameLevel(), PrepareSendCoarseToFineAMR(), and
 //! PrepareSendFineToCoarseAMR() functions in amr_loadbalance.cpp
 
-void MeshRefinement::PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+template <typename T>
+void MeshRefinement::PackAMRBuffersCC(DvceArray5D<T> &a, DvceArray5D<T> &ca,
                                       int ncc, int nfc) {
 #if MPI_PARALLEL_ENABLED
   auto &sbuf = sendbuf;
@@ -682,6 +850,14 @@ void MeshRefinement::PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &c
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::PackAMRBuffersCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca, int ncc, int nfc);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::PackAMRBuffersCC<RadReal>(DvceArray5D<RadReal> &a,
+    DvceArray5D<RadReal> &ca, int ncc, int nfc);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::PackAMRBuffersFC()
 //! \brief Packs face-centered data into AMR communication buffers for all MBs being sent
@@ -851,7 +1027,8 @@ void MeshRefinement::ClearRecvAndUnpackAMR() {
 //! Equivalent to FinishRecvSameLevel(), FinishRecvCoarseToFineAMR(), and
 //! FinishRecvFineToCoarseAMR() functions in amr_loadbalance.cpp
 
-void MeshRefinement::UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+template <typename T>
+void MeshRefinement::UnpackAMRBuffersCC(DvceArray5D<T> &a, DvceArray5D<T> &ca,
                                         int ncc, int nfc) {
 #if MPI_PARALLEL_ENABLED
   auto &rbuf = recvbuf;
@@ -896,6 +1073,14 @@ void MeshRefinement::UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real>
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::UnpackAMRBuffersCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca, int ncc, int nfc);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::UnpackAMRBuffersCC<RadReal>(DvceArray5D<RadReal> &a,
+    DvceArray5D<RadReal> &ca, int ncc, int nfc);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::UnpackAMRBuffersFC()
 //! \brief Unpacks face-centered data from AMR communication buffers into appropriate
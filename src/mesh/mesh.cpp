@@ -12,6 +12,7 @@
 #include <limits>
 #include <cstdio> // fclose
 #include <string> // string
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -53,7 +54,10 @@ Mesh::Mesh(ParameterInput *pin) :
   nprtcl_thisrank(0),
   nprtcl_total(0),
   dtold(0.),
-  dt_last_completed(0.) {
+  dt_last_completed(0.),
+  dt_diff(std::numeric_limits<float>::max()),
+  dt_reduce_{0.,0.},
+  dt_reduce_posted_(false) {
   // Set physical size and number of cells in mesh (root level)
   mesh_size.x1min = pin->GetReal("mesh", "x1min");
   mesh_size.x1max = pin->GetReal("mesh", "x1max");
@@ -177,6 +181,44 @@ Mesh::Mesh(ParameterInput *pin) :
   multilevel = (adaptive || pin->GetString("mesh_refinement","refinement") == "static")
     ?  true : false;
 
+  // read strategy used to distribute MeshBlocks across ranks, see load_balance.cpp
+  {
+    std::string lb = pin->GetOrAddString("mesh_refinement","load_balancing","cost");
+    if (lb.compare("cost") == 0) {
+      lb_strategy = LoadBalanceStrategy::cost;
+    } else if (lb.compare("comm_volume") == 0) {
+      lb_strategy = LoadBalanceStrategy::comm_volume;
+    } else {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<mesh_refinement>/load_balancing = '" << lb
+                << "' not implemented" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    lb_tolerance = pin->GetOrAddReal("mesh_refinement","lb_tolerance",0.1);
+    lb_comm_weight = pin->GetOrAddReal("mesh_refinement","lb_comm_weight",1.0);
+    lb_offnode_weight = pin->GetOrAddReal("mesh_refinement","lb_offnode_weight",4.0);
+  }
+
+  // diffusion terms integrated with super-time-stepping, see Driver::ExecuteSTS()
+  use_sts = (pin->GetOrAddString("time","sts_integrator","none") != "none");
+  sts_max_dt_ratio = pin->GetOrAddReal("time","sts_max_dt_ratio",-1.0);
+
+  // store node of each rank, labelled by lowest rank sharing memory on that node
+  node_eachrank = new int[global_variable::nranks];
+#if MPI_PARALLEL_ENABLED
+  {
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, global_variable::my_rank,
+                        MPI_INFO_NULL, &node_comm);
+    int node_leader = global_variable::my_rank;
+    MPI_Bcast(&node_leader, 1, MPI_INT, 0, node_comm);
+    MPI_Comm_free(&node_comm);
+    MPI_Allgather(&node_leader, 1, MPI_INT, node_eachrank, 1, MPI_INT, MPI_COMM_WORLD);
+  }
+#else
+  node_eachrank[0] = 0;
+#endif
+
   // FIXME: The shearing box is not currently compatible with SMR/AMR
   if (multilevel && pin->DoesBlockExist("shearing_box")) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
@@ -342,11 +384,13 @@ Mesh::~Mesh() {
     delete pmr;
   }
   delete pmb_pack;
+  delete pmb_pool;
   delete [] nmb_eachrank;
   delete [] gids_eachrank;
   delete [] lloc_eachmb;
   delete [] rank_eachmb;
   delete [] cost_eachmb;
+  delete [] node_eachrank;
 }
 
 //----------------------------------------------------------------------------------------
@@ -414,6 +458,31 @@ void Mesh::PrintMeshDiagnostics() {
       << static_cast<float>(maxcost)/static_cast<float>(mincost) << ", Average = "
       << static_cast<float>(totalcost)/static_cast<float>(global_variable::nranks*mincost)
       << std::endl;
+
+    // output ghost-zone communication created by partition, computed using each of the
+    // load balancing strategies for comparison
+    std::vector<MeshBlockFace> faces;
+    FindMeshBlockFaces(faces);
+    int *rlist = new int[nmb_total];
+    float bytes_per_cell = static_cast<float>(mb_indcs.ng*sizeof(Real));
+    std::cout << "Communication (per cell-centered variable per stage):" << std::endl;
+    for (int n=0; n<2; ++n) {
+      LoadBalanceStrategy strategy = (n == 0)? LoadBalanceStrategy::cost :
+                                               LoadBalanceStrategy::comm_volume;
+      if (strategy == LoadBalanceStrategy::cost) {
+        PartitionByCost(cost_eachmb, rlist, nmb_total);
+      } else {
+        PartitionByCommVolume(cost_eachmb, rlist, nmb_total);
+      }
+      float ncut, noffnode;
+      CutSurface(rlist, faces, ncut, noffnode);
+      std::cout << "  load_balancing = " << ((n == 0)? "cost" : "comm_volume")
+                << ((strategy == lb_strategy)? " (in use)" : "")
+                << ": cut surface = " << ncut << " cells, bytes = "
+                << 2.0*ncut*bytes_per_cell << ", off-node bytes = "
+                << 2.0*noffnode*bytes_per_cell << std::endl;
+    }
+    delete [] rlist;
   }
 }
 
@@ -566,6 +635,9 @@ std::string Mesh::GetBoundaryString(BoundaryFlag input_flag) {
 
 //----------------------------------------------------------------------------------------
 // \fn Mesh::NewTimeStep()
+// \brief Sets the timestep for the next cycle to the minimum over all MeshBlocks on all
+// ranks.  If PostNewTimeStep() was called this only waits for its reduction to complete,
+// otherwise the minimum is computed and reduced here.
 
 void Mesh::NewTimeStep(const Real tlim) {
   // save old timestep
@@ -574,68 +646,118 @@ void Mesh::NewTimeStep(const Real tlim) {
     dtold = 0.;
   }
 
+  if (dt_reduce_posted_) {
+#if MPI_PARALLEL_ENABLED
+    MPI_Wait(&dt_reduce_req_, MPI_STATUS_IGNORE);
+#endif
+    dt_reduce_posted_ = false;
+  } else {
+    LocalNewTimeStep(dt_reduce_[0], dt_reduce_[1]);
+#if MPI_PARALLEL_ENABLED
+    // get minimum dt over all MPI ranks
+    MPI_Allreduce(MPI_IN_PLACE, dt_reduce_, 2, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+#endif
+  }
+  dt = dt_reduce_[0];
+  dt_diff = dt_reduce_[1];
+
+  // with STS, optionally limit ratio of timestep to that of diffusion terms
+  if (use_sts && (sts_max_dt_ratio > 0.0)) {
+    dt = std::min(dt, sts_max_dt_ratio*dt_diff);
+  }
+
+  // limit last time step to stop at tlim *exactly*
+  if ( (time < tlim) && ((time + dt) > tlim) ) {dt = tlim - time;}
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \fn Mesh::PostNewTimeStep()
+// \brief Computes the new timestep on this rank and starts a non-blocking reduction over
+// all ranks, which is completed in the next call to NewTimeStep().  Called by the Driver
+// as soon as the physics modules have computed their timesteps, so that the reduction
+// overlaps with outputs and refinement checks.  If called again before NewTimeStep()
+// (e.g. after the mesh is refined) the earlier reduction is discarded.
+
+void Mesh::PostNewTimeStep() {
+  if (dt_reduce_posted_) {
+#if MPI_PARALLEL_ENABLED
+    MPI_Wait(&dt_reduce_req_, MPI_STATUS_IGNORE);
+#endif
+    dt_reduce_posted_ = false;
+  }
+  LocalNewTimeStep(dt_reduce_[0], dt_reduce_[1]);
+#if MPI_PARALLEL_ENABLED
+  MPI_Iallreduce(MPI_IN_PLACE, dt_reduce_, 2, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD,
+                 &dt_reduce_req_);
+#endif
+  dt_reduce_posted_ = true;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \fn Mesh::LocalNewTimeStep()
+// \brief Computes the minimum of the timesteps of all physics modules on this rank.
+// Timesteps of diffusion terms integrated with STS are returned separately in dtdiff.
+
+void Mesh::LocalNewTimeStep(Real &dtnew, Real &dtdiff) {
   // cycle over all MeshBlocks on this rank and find minimum dt
   // Requires at least ONE of the physics modules to be defined.
   // limit increase in timestep to 2x old value
-  dt = 2.0*dt;
+  dtnew = 2.0*dt;
+  dtdiff = std::numeric_limits<float>::max();
+  Real &dtparab = (use_sts)? dtdiff : dtnew;
 
   // Hydro timestep
   if (pmb_pack->phydro != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->dtnew) );
+    dtnew = std::min(dtnew, (cfl_no)*(pmb_pack->phydro->dtnew) );
     // viscosity timestep
     if (pmb_pack->phydro->pvisc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
+      dtparab = std::min(dtparab, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
     }
     // thermal conduction timestep
     if (pmb_pack->phydro->pcond != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
+      dtparab = std::min(dtparab, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
     }
     // source terms timestep
     if (pmb_pack->phydro->psrc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->psrc->dtnew) );
+      dtnew = std::min(dtnew, (cfl_no)*(pmb_pack->phydro->psrc->dtnew) );
     }
   }
   // MHD timestep
   if (pmb_pack->pmhd != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->dtnew) );
+    dtnew = std::min(dtnew, (cfl_no)*(pmb_pack->pmhd->dtnew) );
     // viscosity timestep
     if (pmb_pack->pmhd->pvisc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
+      dtparab = std::min(dtparab, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
     }
     // resistivity timestep
     if (pmb_pack->pmhd->presist != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
+      dtparab = std::min(dtparab, (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
     }
     // thermal conduction timestep
     if (pmb_pack->pmhd->pcond != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
+      dtparab = std::min(dtparab, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
     }
     // source terms timestep
     if (pmb_pack->pmhd->psrc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->psrc->dtnew) );
+      dtnew = std::min(dtnew, (cfl_no)*(pmb_pack->pmhd->psrc->dtnew) );
     }
   }
   // z4c timestep
   if (pmb_pack->pz4c != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->pz4c->dtnew) );
+    dtnew = std::min(dtnew, (cfl_no)*(pmb_pack->pz4c->dtnew) );
   }
   // Radiation timestep
   if (pmb_pack->prad != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->prad->dtnew) );
+    dtnew = std::min(dtnew, (cfl_no)*(pmb_pack->prad->dtnew) );
   }
   // Particles timestep
   if (pmb_pack->ppart != nullptr) {
-    dt = std::min(dt, (pmb_pack->ppart->dtnew) );
+    dtnew = std::min(dtnew, (pmb_pack->ppart->dtnew) );
   }
 
-#if MPI_PARALLEL_ENABLED
-  // get minimum dt over all MPI ranks
-  MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
-#endif
-
-  // limit last time step to stop at tlim *exactly*
-  if ( (time < tlim) && ((time + dt) > tlim) ) {dt = tlim - time;}
-
   return;
 }
 
@@ -14,6 +14,7 @@
 #include <cstdint>  // int32_t
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 
@@ -69,14 +70,29 @@ struct LogicalLocation {
 
 struct EventCounters {
   int nfofc, neos_dfloor, neos_efloor, neos_tfloor, neos_vceil, neos_fail, maxit_c2p;
+  int ncool_fallback;   // cells where exact cooling integration fell back to subcycling
   EventCounters() : nfofc(0), neos_dfloor(0), neos_efloor(0), neos_tfloor(0),
-                    neos_vceil(0), neos_fail(0), maxit_c2p(0) {}
+                    neos_vceil(0), neos_fail(0), maxit_c2p(0), ncool_fallback(0) {}
 };
 
+//----------------------------------------------------------------------------------------
+//! \struct MeshBlockFace
+//! \brief pair of MeshBlocks (by gid) that share a face, and # of cells on that face.
+//! Used to estimate the volume of ghost-zone communication created by a partition.
+
+struct MeshBlockFace {
+  int gida, gidb;  // global IDs of MeshBlocks on either side of face
+  float ncells;    // number of (finer) cells on face
+};
+
+// Strategies used to distribute MeshBlocks across ranks in Mesh::LoadBalance()
+enum class LoadBalanceStrategy {cost, comm_volume};
+
 // Forward declarations required due to recursive definitions amongst mesh classes
 class MeshBlock;
 class MeshBlockPack;
 class MeshBlockTree;
+class MeshBlockPool;
 class Mesh;
 
 #include "parameter_input.hpp"
@@ -84,6 +100,7 @@ class Mesh;
 #include "meshblock_pack.hpp"
 #include "meshblock_tree.hpp"
 #include "mesh_refinement.hpp"
+#include "meshblock_pool.hpp"
 
 //----------------------------------------------------------------------------------------
 //! \class Mesh
@@ -118,7 +135,14 @@ class Mesh {
   int nmb_rootx1, nmb_rootx2, nmb_rootx3; // # of MeshBlocks at root level in each dir
   int nmb_total;           // total number of MeshBlocks across all levels/ranks
   int nmb_thisrank;        // number of MeshBlocks on this MPI rank (local)
-  int nmb_maxperrank;      // max allowed number of MBs per device (memory limit for AMR)
+  int nmb_maxperrank;      // # of MB slots allocated per rank (managed by MeshBlockPool)
+
+  // parameters controlling distribution of MeshBlocks across ranks
+  LoadBalanceStrategy lb_strategy;  // cost only, or cost + ghost-zone communication
+  float lb_tolerance;      // max allowed fractional load imbalance with comm_volume
+  float lb_comm_weight;    // cost of exchanging a ghost cell relative to a cell update
+  float lb_offnode_weight; // extra weight of ghost cells exchanged between nodes
+  int *node_eachrank;      // node (shared memory domain) of each rank, length [nranks]
 
   int root_level; // logical level of root (physical) grid (e.g. Fig. 3 of method paper)
   int max_level;  // logical level of maximum refinement grid in Mesh
@@ -138,6 +162,11 @@ class Mesh {
   int *nprtcl_eachrank;    // number of particles on each rank
 
   Real time, dt, dtold, dt_last_completed, cfl_no;
+  // diffusion terms (viscosity, resistivity, conduction) integrated with super-time-
+  // stepping do not limit dt.  Instead their (CFL-limited) timestep is stored in dt_diff
+  bool use_sts;            // true if <time>/sts_integrator is not "none"
+  Real sts_max_dt_ratio;   // if >0, limits dt to sts_max_dt_ratio*dt_diff
+  Real dt_diff;
   int ncycle;
   EventCounters ecounter;
 
@@ -145,6 +174,7 @@ class Mesh {
   MeshBlockPack* pmb_pack;                 // container for MeshBlocks on this rank
   std::unique_ptr<ProblemGenerator> pgen;  // class containing functions to set ICs
   MeshRefinement *pmr=nullptr;             // mesh refinement data/functions (if needed)
+  MeshBlockPool *pmb_pool=nullptr;         // storage pool for per-MeshBlock arrays
 
   // functions
   void BuildTreeFromScratch(ParameterInput *pin);
@@ -153,6 +183,7 @@ class Mesh {
   void PrintMeshDiagnostics();
   void WriteMeshStructure();
   void NewTimeStep(const Real tlim);
+  void PostNewTimeStep();
   void AddCoordinatesAndPhysics(ParameterInput *pinput);
   BoundaryFlag GetBoundaryFlag(const std::string& input_string);
   std::string GetBoundaryString(BoundaryFlag input_flag);
@@ -175,6 +206,19 @@ class Mesh {
 
  private:
   std::unique_ptr<MeshBlockTree> ptree;  // pointer to root node in binary/quad/oct-tree
+  // new timestep, reduced over all ranks by non-blocking collective between calls to
+  // PostNewTimeStep() and NewTimeStep()
+  Real dt_reduce_[2];      // (dt, dt_diff)
+  bool dt_reduce_posted_;
+#if MPI_PARALLEL_ENABLED
+  MPI_Request dt_reduce_req_;
+#endif
+  void LocalNewTimeStep(Real &dtnew, Real &dtdiff);
   void LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb);
+  void PartitionByCost(float *clist, int *rlist, int nb);
+  void PartitionByCommVolume(float *clist, int *rlist, int nb);
+  void FindMeshBlockFaces(std::vector<MeshBlockFace> &faces);
+  void CutSurface(int *rlist, const std::vector<MeshBlockFace> &faces, float &ncut,
+                  float &noffnode);
 };
 #endif  // MESH_MESH_HPP_
@@ -135,6 +135,8 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
     if (pmbp->pz4c != nullptr) {
       (void) pmbp->pz4c->NewTimeStep(pdriver, pdriver->nexp_stages);
     }
+    // timestep reduction started by Driver is out of date, so restart it on new mesh
+    pmy_mesh->PostNewTimeStep();
 
     nmb_created += nnew;
     nmb_deleted += ndel;
@@ -439,14 +441,8 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   for (int i=0; i<new_nmb; i++) {new_cost_eachmb[i] = 1.0;}
   pm->LoadBalance(new_cost_eachmb, new_rank_eachmb, new_gids_eachrank, new_nmb_eachrank,
                   new_nmb_total);
-  if (new_nmb_eachrank[global_variable::my_rank] > pm->nmb_maxperrank) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
-        << "Number of MeshBlocks in this rank on new tree = "
-        << new_nmb_eachrank[global_variable::my_rank] << " on rank = "
-        << global_variable::my_rank <<" exceeds <mesh_refinement>/max_nmb_per_rank = "
-        << pm->nmb_maxperrank << std::endl;
-    std::exit(EXIT_FAILURE);
-  }
+  // Grow per-MeshBlock arrays if new number of MBs on this rank exceeds allocated slots
+  pm->pmb_pool->Grow(new_nmb_eachrank[global_variable::my_rank]);
 
   // UpdateMeshBlockTree function can refine/de-refine MBs to ensure resolution jump is
   // no more than 2x at boundaries, even if refine flag not set in these MBs.  So loop
@@ -589,6 +585,10 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   Kokkos::realloc(ncyc_since_ref, new_nmb_total);
   Kokkos::deep_copy(ncyc_since_ref, new_ncyc_since_ref);
 
+  // Data for MBs on this rank now stored contiguously in first new_nmb slots of arrays,
+  // so release unused slots
+  pm->pmb_pool->Shrink(new_nmb_eachrank[global_variable::my_rank]);
+
   // Update data in Mesh/MeshBlockPack/MeshBlock classes with new grid properties
   delete [] pm->lloc_eachmb;
   delete [] pm->rank_eachmb;
@@ -641,7 +641,8 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
 //! immediately following to the appropriate quadrant of the MeshBlock m in the input
 //! fine array,overwriting any data located there.  Only operates on MBs on the same rank
 
-void MeshRefinement::DerefineCCSameRank(DvceArray5D<Real> &a, DvceArray5D<Real> &ca) {
+template <typename T>
+void MeshRefinement::DerefineCCSameRank(DvceArray5D<T> &a, DvceArray5D<T> &ca) {
   // nleaf = number of leaf MeshBlocks per refined block
   int nleaf = 2;
   if (pmy_mesh->two_d) nleaf = 4;
@@ -690,6 +691,14 @@ void MeshRefinement::DerefineCCSameRank(DvceArray5D<Real> &a, DvceArray5D<Real>
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::DerefineCCSameRank<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::DerefineCCSameRank<RadReal>(DvceArray5D<RadReal> &a,
+    DvceArray5D<RadReal> &ca);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::DerefineFCSameRank
 //! \brief Same as DerefineCCSameRank, except for face-centered variables
@@ -760,7 +769,8 @@ void MeshRefinement::DerefineFCSameRank(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
 //! \brief Copy cell-centered variables to new MB index within View for MeshBlocks that
 //! stay within this rank
 
-void MeshRefinement::CopyCC(DvceArray5D<Real> &a) {
+template <typename T>
+void MeshRefinement::CopyCC(DvceArray5D<T> &a) {
   int ombs = pmy_mesh->gids_eachrank[global_variable::my_rank];
   int ombe = ombs + pmy_mesh->nmb_eachrank[global_variable::my_rank] - 1;
 
@@ -799,6 +809,12 @@ void MeshRefinement::CopyCC(DvceArray5D<Real> &a) {
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::CopyCC<Real>(DvceArray5D<Real> &a);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::CopyCC<RadReal>(DvceArray5D<RadReal> &a);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::CopyFC
 //! \brief Copy face-centered variables to new MB index within View for MeshBlocks that
@@ -862,7 +878,8 @@ void MeshRefinement::CopyFC(DvceFaceFld4D<Real> &b) {
 //! the nleaf-index locations that are immediately following (overwriting any data located
 //! there).  Only operates on MBs on the same rank.
 
-void MeshRefinement::CopyForRefinementCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca) {
+template <typename T>
+void MeshRefinement::CopyForRefinementCC(DvceArray5D<T> &a, DvceArray5D<T> &ca) {
   auto &indcs = pmy_mesh->mb_indcs;
   auto &ng = indcs.ng;
   int il = indcs.cis - ng, iu = indcs.cie + ng;
@@ -910,6 +927,14 @@ void MeshRefinement::CopyForRefinementCC(DvceArray5D<Real> &a, DvceArray5D<Real>
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::CopyForRefinementCC<Real>(DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::CopyForRefinementCC<RadReal>(DvceArray5D<RadReal> &a,
+    DvceArray5D<RadReal> &ca);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::CopyForRefinementFC
 //! \brief Same as CopyForRefinementCC, but for face-centered arrays
@@ -981,8 +1006,9 @@ void MeshRefinement::CopyForRefinementFC(DvceFaceFld4D<Real> &b,DvceFaceFld4D<Re
 //! overwriting any data located there. The data in these locations must already have been
 //! copied to another location or sent to another rank via MPI.
 
-void MeshRefinement::RefineCC(DualArray1D<int> &n2o, DvceArray5D<Real> &a,
-                              DvceArray5D<Real> &ca, bool is_z4c) {
+template <typename T>
+void MeshRefinement::RefineCC(DualArray1D<int> &n2o, DvceArray5D<T> &a,
+                              DvceArray5D<T> &ca, bool is_z4c) {
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
   auto &new_nmb = new_nmb_eachrank[global_variable::my_rank];
   auto &indcs = pmy_mesh->mb_indcs;
@@ -1046,6 +1072,14 @@ void MeshRefinement::RefineCC(DualArray1D<int> &n2o, DvceArray5D<Real> &a,
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::RefineCC<Real>(DualArray1D<int> &n2o, DvceArray5D<Real> &a,
+    DvceArray5D<Real> &ca, bool is_z4c);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::RefineCC<RadReal>(DualArray1D<int> &n2o,
+    DvceArray5D<RadReal> &a, DvceArray5D<RadReal> &ca, bool is_z4c);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::RefineFC
 //! \brief Same as RefineCC, except for face-centered arrays
@@ -1131,7 +1165,8 @@ void MeshRefinement::RefineFC(DualArray1D<int> &n2o, DvceFaceFld4D<Real> &b,
 //! \fn void MeshRefinement::RestrictCC
 //!  \brief Restricts cell-centered variables to coarse mesh
 
-void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
+template <typename T>
+void MeshRefinement::RestrictCC(DvceArray5D<T> &u, DvceArray5D<T> &cu,
     bool is_z4c) {
   int nmb  = u.extent_int(0);  // TODO(@user): 1st index from L of in array must be NMB
   int nvar = u.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
@@ -1191,6 +1226,14 @@ void MeshRefinement::RestrictCC(DvceArray5D<Real> &u, DvceArray5D<Real> &cu,
   return;
 }
 
+// function definitions for each template parameter
+template void MeshRefinement::RestrictCC<Real>(DvceArray5D<Real> &u,
+    DvceArray5D<Real> &cu, bool is_z4c);
+#if RAD_MIXED_PRECISION_ENABLED
+template void MeshRefinement::RestrictCC<RadReal>(DvceArray5D<RadReal> &u,
+    DvceArray5D<RadReal> &cu, bool is_z4c);
+#endif
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::RestrictFC
 //! \brief Restricts face-centered variables to coarse mesh
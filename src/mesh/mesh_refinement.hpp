@@ -102,30 +102,39 @@ class MeshRefinement {
   void UpdateMeshBlockTree(int &nnew, int &ndel);
   void RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, int ndel);
 
-  void DerefineCCSameRank(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  // functions for CC data are templated on the value type T of the arrays (Real, or
+  // RadReal for radiation intensities)
+  template <typename T>
+  void DerefineCCSameRank(DvceArray5D<T> &a, DvceArray5D<T> &ca);
   void DerefineFCSameRank(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
 
-  void CopyCC(DvceArray5D<Real> &a);
+  template <typename T>
+  void CopyCC(DvceArray5D<T> &a);
   void CopyFC(DvceFaceFld4D<Real> &b);
 
-  void CopyForRefinementCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
+  template <typename T>
+  void CopyForRefinementCC(DvceArray5D<T> &a, DvceArray5D<T> &ca);
   void CopyForRefinementFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
 
-  void RefineCC(DualArray1D<int> &n2o, DvceArray5D<Real> &a, DvceArray5D<Real> &ca,
+  template <typename T>
+  void RefineCC(DualArray1D<int> &n2o, DvceArray5D<T> &a, DvceArray5D<T> &ca,
                 bool is_z4c=false);
   void RefineFC(DualArray1D<int> &n2o, DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
 
-  void RestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, bool is_z4c=false);
+  template <typename T>
+  void RestrictCC(DvceArray5D<T> &a, DvceArray5D<T> &ca, bool is_z4c=false);
   void RestrictFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb);
   void HighOrderRestrictCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca);
 
   // functions for load balancing (in file load_balance.cpp)
   void InitRecvAMR(int nleaf);
   void PackAndSendAMR(int nleaf);
-  void PackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc, int nfc);
+  template <typename T>
+  void PackAMRBuffersCC(DvceArray5D<T> &a, DvceArray5D<T> &ca, int ncc, int nfc);
   void PackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Real> &cb, int ncc,int nfc);
   void ClearRecvAndUnpackAMR();
-  void UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc,int nfc);
+  template <typename T>
+  void UnpackAMRBuffersCC(DvceArray5D<T> &a, DvceArray5D<T> &ca, int ncc, int nfc);
   void UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b,DvceFaceFld4D<Real> &cb,int ncc,int nfc);
   void ClearSendAMR();
 
@@ -29,6 +29,7 @@
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
 #include "particles/particles.hpp"
+#include "gravity/gravity.hpp"
 #include "units/units.hpp"
 #include "meshblock_pack.hpp"
 
@@ -46,12 +47,17 @@ MeshBlockPack::MeshBlockPack(Mesh *pm, int igids, int igide) :
   tl_map.insert(std::make_pair("before_stagen",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("stagen",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("after_stagen",std::make_shared<TaskList>()));
+  // task lists for super-time-stepping of diffusion terms (see Driver::ExecuteSTS())
+  tl_map.insert(std::make_pair("before_sts",std::make_shared<TaskList>()));
+  tl_map.insert(std::make_pair("sts",std::make_shared<TaskList>()));
+  tl_map.insert(std::make_pair("after_sts",std::make_shared<TaskList>()));
 }
 
 //----------------------------------------------------------------------------------------
 // MeshBlock destructor
 
 MeshBlockPack::~MeshBlockPack() {
+  if (pgrav  != nullptr) {delete pgrav;}
   if (ppart  != nullptr) {delete ppart;}
   if (pnr    != nullptr) {delete pnr;}
   if (pdyngr != nullptr) {delete pdyngr;}
@@ -239,6 +245,21 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
     ppart = nullptr;
   }
 
+  // (10) SELF-GRAVITY
+  // Potential is computed with multigrid at the start of each stage, and the resulting
+  // acceleration is applied in the Hydro/MHD source terms.
+  if (pin->DoesBlockExist("gravity")) {
+    if (phydro == nullptr && pmhd == nullptr) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "<gravity> block requires Hydro and/or MHD" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    pgrav = new gravity::Gravity(this, pin);
+    pgrav->IncludeSolveTask(tl_map["before_stagen"], none);
+  } else {
+    pgrav = nullptr;
+  }
+
   // Check that at least ONE is requested and initialized.
   // Error if there are no physics blocks in the input file.
   if (nphysics == 0) {
@@ -247,5 +268,14 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
     std::exit(EXIT_FAILURE);
   }
 
+  // Super-time-stepping of diffusion terms is only implemented for single-fluid Hydro and
+  // MHD, which add tasks to the "sts" TaskList.
+  if (pmesh->use_sts && tl_map["sts"]->Empty()) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+        << "<time>/sts_integrator can only be used with single-fluid Hydro or MHD"
+        << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   return;
 }
@@ -34,6 +34,7 @@ namespace z4c {class Z4c;}
 namespace z4c {class CCE;}
 namespace adm {class ADM;}
 namespace particles {class Particles;}
+namespace gravity {class Gravity;}
 namespace units {class Units;}
 
 //----------------------------------------------------------------------------------------
@@ -74,6 +75,7 @@ class MeshBlockPack {
   radiation::Radiation *prad=nullptr;
   std::vector<z4c::CCE *> pz4c_cce;
   particles::Particles *ppart=nullptr;
+  gravity::Gravity *pgrav=nullptr;
 
   // units (needed to convert code units to cgs for, e.g., cooling or radiation)
   units::Units *punit=nullptr;
@@ -0,0 +1,142 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file meshblock_pool.cpp
+//! \brief implements functions in MeshBlockPool class
+
+#include <algorithm> // max
+#include <iostream>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh.hpp"
+#include "meshblock_pool.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+// MeshBlockPool constructor:
+// called from Mesh::BuildTree after MeshBlocks are distributed across ranks, and before
+// physics modules are enrolled (so that they can register their arrays with the pool).
+
+MeshBlockPool::MeshBlockPool(Mesh *pm, ParameterInput *pin) :
+  nresize(0),
+  pmy_mesh(pm) {
+  nslots = pm->nmb_thisrank;
+  nslots_chunk = 1;
+  if (pm->adaptive) {
+    // Optionally reserve minimum number of slots (previously a hard limit with AMR)
+    if (pin->DoesParameterExist("mesh_refinement", "max_nmb_per_rank")) {
+      int nmax = static_cast<int>(pin->GetReal("mesh_refinement","max_nmb_per_rank"));
+      nslots = std::max(nslots, nmax);
+    }
+    // number of slots added/removed when pool is resized
+    if (pin->DoesParameterExist("mesh_refinement", "nmb_pool_chunk")) {
+      nslots_chunk = pin->GetInteger("mesh_refinement", "nmb_pool_chunk");
+    } else {
+      nslots_chunk = std::max(8, (pm->nmb_thisrank)/4);
+    }
+    if (nslots_chunk < 1) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<mesh_refinement>/nmb_pool_chunk=" << nslots_chunk
+                << " must be >= 1" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  nslots_min = nslots;
+  nmb_hwm = pm->nmb_thisrank;
+  nslots_hwm = nslots;
+  pm->nmb_maxperrank = nslots;
+#if MPI_PARALLEL_ENABLED
+  if (nslots > (1 << (NUM_BITS_LID))) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+      << "Maximum number of MeshBlocks per rank cannot exceed 2^(NUM_BITS_LID) due to MPI"
+      << " tag limits" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockPool::Grow(int nmb)
+//! \brief Ensures there are at least nmb slots in all registered arrays, growing them in
+//! multiples of nslots_chunk if needed.  Called in RedistAndRefineMeshBlocks() before
+//! any data is moved into MeshBlocks at new locations.
+
+void MeshBlockPool::Grow(int nmb) {
+  nmb_hwm = std::max(nmb_hwm, nmb);
+  if (nmb <= nslots) return;
+  int nchunks = (nmb - nslots + nslots_chunk - 1)/nslots_chunk;
+  Resize(nslots + nchunks*nslots_chunk);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockPool::Shrink(int nmb)
+//! \brief Releases slots no longer needed after derefinement/load balancing.  Keeps one
+//! extra chunk of free slots to avoid resizing every time the mesh is adapted, and
+//! never shrinks below nslots_min.  Must only be called once data for the nmb MeshBlocks
+//! on this rank has been moved into slots [0,nmb).
+
+void MeshBlockPool::Shrink(int nmb) {
+  int nkeep = std::max(nslots_min, nmb + nslots_chunk);
+  if (nslots - nkeep >= nslots_chunk) {
+    Resize(nkeep);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockPool::Resize(int n)
+//! \brief Resizes all registered arrays to n slots
+
+void MeshBlockPool::Resize(int n) {
+#if MPI_PARALLEL_ENABLED
+  if (n > (1 << (NUM_BITS_LID))) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+      << "Number of MeshBlocks on rank=" << global_variable::my_rank << " cannot exceed "
+      << "2^(NUM_BITS_LID) due to MPI tag limits" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#endif
+  for (auto &func : resize_func_) {
+    func(n);
+  }
+  nslots = n;
+  nslots_hwm = std::max(nslots_hwm, nslots);
+  nresize++;
+  pmy_mesh->nmb_maxperrank = nslots;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockPool::PrintDiagnostics()
+//! \brief Prints high-water mark of the number of MeshBlocks and allocated slots on each
+//! rank. Must be called by all ranks, only root rank prints.
+
+void MeshBlockPool::PrintDiagnostics() {
+  int nranks = global_variable::nranks;
+  int myhwm[2] = {nmb_hwm, nslots_hwm};
+  int *hwm = new int[2*nranks];
+#if MPI_PARALLEL_ENABLED
+  MPI_Gather(myhwm, 2, MPI_INT, hwm, 2, MPI_INT, 0, MPI_COMM_WORLD);
+#else
+  hwm[0] = myhwm[0];
+  hwm[1] = myhwm[1];
+#endif
+  if (global_variable::my_rank == 0) {
+    std::cout << "MeshBlock pool high-water mark (MeshBlocks/slots), resized "
+              << nresize << " times on rank 0:" << std::endl;
+    for (int n=0; n<nranks; ++n) {
+      std::cout << "  Rank = " << n << ": " << hwm[2*n] << "/" << hwm[2*n+1]
+                << std::endl;
+    }
+  }
+  delete [] hwm;
+  return;
+}
@@ -0,0 +1,91 @@
+#ifndef MESH_MESHBLOCK_POOL_HPP_
+#define MESH_MESHBLOCK_POOL_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file meshblock_pool.hpp
+//! \brief defines MeshBlockPool class, which manages the number of MeshBlock "slots"
+//! (the length of the first, MeshBlock, index) of all per-MeshBlock arrays on a rank.
+//! Physics modules register their arrays with the pool when they are allocated.  With
+//! AMR, the pool grows all registered arrays in chunks when refinement/load balancing
+//! places more MeshBlocks on a rank than there are slots, and shrinks them again after
+//! derefinement.  Data in slots [0,nmb) is preserved; MeshBlocks are already compacted
+//! into these slots by MeshRefinement::CopyCC/FC(), so shrinking also defragments.
+
+#include <functional>
+#include <vector>
+
+#include "athena.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \class MeshBlockPool
+//! \brief storage pool for per-MeshBlock arrays
+
+class MeshBlockPool {
+ public:
+  MeshBlockPool(Mesh *pm, ParameterInput *pin);
+  ~MeshBlockPool() = default;
+
+  // data
+  int nslots;        // number of MeshBlock slots currently allocated in registered arrays
+  int nslots_min;    // minimum number of slots kept on this rank (never shrink below)
+  int nslots_chunk;  // number of slots added/removed each time pool is resized
+  int nmb_hwm;       // high-water mark of number of MeshBlocks stored on this rank
+  int nslots_hwm;    // high-water mark of number of slots allocated on this rank
+  int nresize;       // number of times registered arrays have been resized
+
+  // functions to register arrays whose first index is the MeshBlock
+  template <typename T> void Register(T &a);
+  template <typename T> void Register(DvceFaceFld4D<T> &a) {
+    Register(a.x1f); Register(a.x2f); Register(a.x3f);
+  }
+  template <typename T> void Register(DvceFaceFld5D<T> &a) {
+    Register(a.x1f); Register(a.x2f); Register(a.x3f);
+  }
+  template <typename T> void Register(DvceEdgeFld4D<T> &a) {
+    Register(a.x1e); Register(a.x2e); Register(a.x3e);
+  }
+  // register general function called with new number of slots, used for arrays in which
+  // MeshBlock is not the first index, or to reset shallow slices after a resize
+  void RegisterFunction(std::function<void(int)> func) {resize_func_.push_back(func);}
+
+  void Grow(int nmb);
+  void Shrink(int nmb);
+  void PrintDiagnostics();
+
+ private:
+  Mesh *pmy_mesh;
+  std::vector<std::function<void(int)>> resize_func_;
+  void Resize(int n);
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockPool::Register(T &a)
+//! \brief registers Kokkos View with MeshBlock as first index.  On resize the data in
+//! the first min(old,new) slots is preserved (Kokkos::resize).
+
+template <typename T>
+void MeshBlockPool::Register(T &a) {
+  resize_func_.push_back([&a](int n) {
+    if constexpr (T::rank == 2) {
+      Kokkos::resize(a, n, a.extent(1));
+    } else if constexpr (T::rank == 3) {
+      Kokkos::resize(a, n, a.extent(1), a.extent(2));
+    } else if constexpr (T::rank == 4) {
+      Kokkos::resize(a, n, a.extent(1), a.extent(2), a.extent(3));
+    } else if constexpr (T::rank == 5) {
+      Kokkos::resize(a, n, a.extent(1), a.extent(2), a.extent(3), a.extent(4));
+    } else if constexpr (T::rank == 6) {
+      Kokkos::resize(a, n, a.extent(1), a.extent(2), a.extent(3), a.extent(4),
+                     a.extent(5));
+    } else {
+      static_assert(T::rank == 7, "MeshBlockPool::Register unsupported View rank");
+      Kokkos::resize(a, n, a.extent(1), a.extent(2), a.extent(3), a.extent(4),
+                     a.extent(5), a.extent(6));
+    }
+  });
+}
+
+#endif // MESH_MESHBLOCK_POOL_HPP_
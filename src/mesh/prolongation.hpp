@@ -15,11 +15,12 @@
 //! \fn ProlongCC()
 //! \brief 2nd-order (piecewise-linear) prolongation operator for cell-centered variables
 
+template <typename T>
 KOKKOS_INLINE_FUNCTION
 void ProlongCC(const int m, const int v, const int k, const int j, const int i,
                const int fk, const int fj, const int fi,
                const bool multi_d, const bool three_d,
-               const DvceArray5D<Real> &ca, const DvceArray5D<Real> &a) {
+               const DvceArray5D<T> &ca, const DvceArray5D<T> &a) {
   // calculate x1-gradient using the min-mod limiter
   Real dl = ca(m,v,k,j,i  ) - ca(m,v,k,j,i-1);
   Real dr = ca(m,v,k,j,i+1) - ca(m,v,k,j,i  );
@@ -230,12 +231,12 @@ void ProlongFCInternal(const int m, const int fk, const int fj, const int fi,
   return;
 }
 
-template <int NGHOST>
+template <int NGHOST, typename T>
 KOKKOS_INLINE_FUNCTION
 Real ProlongInterpolation(const int m, const int v, int k, int j, int i,
                             const int nx1, const int nx2, const int nx3,
                             const bool offsetk, const bool offsetj, const bool offseti,
-                        const DvceArray5D<Real> &ca, const DualArray3D<Real> &weights) {
+                        const DvceArray5D<T> &ca, const DualArray3D<Real> &weights) {
   // interpolated value at new grid point
   Real ivals = 0;
 
@@ -258,11 +259,11 @@ Real ProlongInterpolation(const int m, const int v, int k, int j, int i,
 //! \fn HighOrderProlongCC()
 //! \brief high-order prolongation operator for cell-centered variables
 
-template <int NGHOST>
+template <int NGHOST, typename T>
 KOKKOS_INLINE_FUNCTION
 void HighOrderProlongCC(const int m, const int v, const int k, const int j, const int i,
                const int fk, const int fj, const int fi, const int nx1, const int nx2,
-               const int nx3, const DvceArray5D<Real> &ca, const DvceArray5D<Real> &a,
+               const int nx3, const DvceArray5D<T> &ca, const DvceArray5D<T> &a,
                const DualArray3D<Real> &weights) {
   // stencil size for interpolator
   a(m,v,fk  ,fj  ,fi  ) = ProlongInterpolation<NGHOST>(m,v,k,j,i, nx1, nx2, nx3,
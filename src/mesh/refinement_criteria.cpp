@@ -101,10 +101,15 @@ RefinementCriteria::RefinementCriteria(Mesh *pm, ParameterInput *pin) :
     int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
     int nmb=std::max((pm->pmb_pack->nmb_thispack), (pm->pmb_pack->pmesh->nmb_maxperrank));
     Kokkos::realloc(dvars, nmb, nderived, ncells3, ncells2, ncells1);
+    pm->pmb_pool->Register(dvars);
   }
 
   // Set rdata array to shallow slice of target data
   SetRefinementData(pm->pmb_pack, false, false);
+  // slices must be reset whenever target data is resized by MeshBlockPool with AMR
+  pm->pmb_pool->RegisterFunction([this, pm](int n) {
+    SetRefinementData(pm->pmb_pack, false, false);
+  });
 }
 
 //----------------------------------------------------------------------------------------
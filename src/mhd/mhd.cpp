@@ -51,6 +51,10 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     e1_cc("e1_cc",1,1,1,1),
     e2_cc("e2_cc",1,1,1,1),
     e3_cc("e3_cc",1,1,1,1),
+    u_sts("cons_sts",1,1,1,1,1),
+    du_sts("dcons_sts",1,1,1,1,1),
+    b_sts("B_fc_sts",1,1,1,1),
+    db_sts("dB_fc_sts",1,1,1,1),
     utest("utest",1,1,1,1,1),
     bcctest("bcctest",1,1,1,1,1),
     fofc("fofc",1,1,1,1),
@@ -118,8 +122,8 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     pcond = nullptr;
   }
 
-  // Source terms (if needed)
-  if (pin->DoesBlockExist("mhd_srcterms")) {
+  // Source terms (if needed).  Self-gravity is applied as a source term.
+  if (pin->DoesBlockExist("mhd_srcterms") || pin->DoesBlockExist("gravity")) {
     psrc = new SourceTerms("mhd_srcterms", ppack, pin);
   }
 
@@ -143,6 +147,10 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     Kokkos::realloc(b0.x1f, nmb, ncells3, ncells2, ncells1+1);
     Kokkos::realloc(b0.x2f, nmb, ncells3, ncells2+1, ncells1);
     Kokkos::realloc(b0.x3f, nmb, ncells3+1, ncells2, ncells1);
+    ppack->pmesh->pmb_pool->Register(u0);
+    ppack->pmesh->pmb_pool->Register(w0);
+    ppack->pmesh->pmb_pool->Register(bcc0);
+    ppack->pmesh->pmb_pool->Register(b0);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -156,6 +164,9 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     Kokkos::realloc(coarse_b0.x1f, nmb, n_ccells3, n_ccells2, n_ccells1+1);
     Kokkos::realloc(coarse_b0.x2f, nmb, n_ccells3, n_ccells2+1, n_ccells1);
     Kokkos::realloc(coarse_b0.x3f, nmb, n_ccells3+1, n_ccells2, n_ccells1);
+    ppack->pmesh->pmb_pool->Register(coarse_u0);
+    ppack->pmesh->pmb_pool->Register(coarse_w0);
+    ppack->pmesh->pmb_pool->Register(coarse_b0);
   }
 
   // allocate boundary buffers for conserved (cell-centered) and face-centered variables
@@ -334,6 +345,28 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      auto &pool = ppack->pmesh->pmb_pool;
+      pool->Register(u1);
+      pool->Register(b1);
+      pool->Register(uflx);
+      pool->Register(efld);
+      pool->Register(e3x1); pool->Register(e2x1); pool->Register(e1x2);
+      pool->Register(e3x2); pool->Register(e2x3); pool->Register(e1x3);
+      pool->Register(e1_cc); pool->Register(e2_cc); pool->Register(e3_cc);
+
+      // allocate registers used with super-time-stepping of diffusion terms
+      if (ppack->pmesh->use_sts) {
+        Kokkos::realloc(u_sts,      nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(du_sts,     nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+        Kokkos::realloc(b_sts.x1f,  nmb, ncells3, ncells2, ncells1+1);
+        Kokkos::realloc(b_sts.x2f,  nmb, ncells3, ncells2+1, ncells1);
+        Kokkos::realloc(b_sts.x3f,  nmb, ncells3+1, ncells2, ncells1);
+        Kokkos::realloc(db_sts.x1f, nmb, ncells3, ncells2, ncells1+1);
+        Kokkos::realloc(db_sts.x2f, nmb, ncells3, ncells2+1, ncells1);
+        Kokkos::realloc(db_sts.x3f, nmb, ncells3+1, ncells2, ncells1);
+        pool->Register(u_sts); pool->Register(du_sts);
+        pool->Register(b_sts); pool->Register(db_sts);
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
@@ -342,8 +375,12 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
         Kokkos::realloc(utest,   nmb, nvars, ncells3, ncells2, ncells1);
         Kokkos::realloc(bcctest, nmb, 3,    ncells3, ncells2, ncells1);
         Kokkos::deep_copy(fofc, false);
+        pool->Register(fofc);
+        pool->Register(utest);
+        pool->Register(bcctest);
         if (nscalars > 0) {
           Kokkos::realloc(fofc_scal,    nmb, nscalars, ncells3, ncells2, ncells1);
+          pool->Register(fofc_scal);
           Kokkos::deep_copy(fofc_scal, false);
         }
       }
@@ -381,6 +418,10 @@ void MHD::SetSaveWBcc() {
   // allocated saved arrays for time derivatives
   Kokkos::realloc(wsaved,   nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
   Kokkos::realloc(bccsaved, nmb, 3,               ncells3, ncells2, ncells1);
+  if (!(wbcc_saved)) {
+    pmy_pack->pmesh->pmb_pool->Register(wsaved);
+    pmy_pack->pmesh->pmb_pool->Register(bccsaved);
+  }
 
   wbcc_saved = true;
 }
@@ -78,6 +78,25 @@ struct MHDTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID sts_irecv;
+  TaskID sts_flux;
+  TaskID sts_sendf;
+  TaskID sts_recvf;
+  TaskID sts_efld;
+  TaskID sts_sende;
+  TaskID sts_recve;
+  TaskID sts_updt;
+  TaskID sts_restu;
+  TaskID sts_sendu;
+  TaskID sts_recvu;
+  TaskID sts_restb;
+  TaskID sts_sendb;
+  TaskID sts_recvb;
+  TaskID sts_bcs;
+  TaskID sts_prol;
+  TaskID sts_c2p;
+  TaskID sts_csend;
+  TaskID sts_crecv;
 };
 
 namespace mhd {
@@ -134,6 +153,12 @@ class MHD {
   DvceArray4D<Real> e2x3, e1x3;
   Real dtnew;
 
+  // following only used with super-time-stepping of diffusion terms
+  DvceArray5D<Real> u_sts;      // conserved variables at start of STS step (Y_0)
+  DvceArray5D<Real> du_sts;     // dt*M(Y_0), change due to diffusion at start of STS step
+  DvceFaceFld4D<Real> b_sts;    // face-centered fields at start of STS step
+  DvceFaceFld4D<Real> db_sts;   // change in face-centered fields at start of STS step
+
   // following used for time derivatives in computation of jcon
   bool wbcc_saved = false;
   DvceArray5D<Real> wsaved;
@@ -187,6 +212,11 @@ class MHD {
   // ...in "after_stagen_tl" task list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
+  // ...in "sts" task list (super-time-stepping of diffusion terms)
+  TaskStatus STSFluxes(Driver *d, int stage);
+  TaskStatus STSEField(Driver *d, int stage);
+  TaskStatus STSUpdate(Driver *d, int stage);
+  TaskStatus STSConToPrim(Driver *d, int stage);
 
   // CalculateFluxes function templated over Riemann Solvers
   template <MHD_RSolver T>
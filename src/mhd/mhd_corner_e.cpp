@@ -30,6 +30,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
   int ks = indcs.ks, ke = indcs.ke;
   int nmb1 = pmy_pack->nmb_thispack - 1;
   auto &size = pmy_pack->pmb->mb_size;
+  auto &coord = pmy_pack->pcoord->coord_data;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
 
@@ -101,7 +102,11 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
         Real x3v = CellCenterX(0, indcs.nx3, x3min, x3max);
 
         Real glower[4][4], gupper[4][4];
-        ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+        if (coord.cache_metric) {
+          LoadMetricAndInverse(coord.gcc, m, ks, j, i, glower, gupper);
+        } else {
+          ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+        }
 
         const Real &ux = w0_(m,IVX,ks,j,i);
         const Real &uy = w0_(m,IVY,ks,j,i);
@@ -258,7 +263,11 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
         Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
         Real glower[4][4], gupper[4][4];
-        ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+        if (coord.cache_metric) {
+          LoadMetricAndInverse(coord.gcc, m, k, j, i, glower, gupper);
+        } else {
+          ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+        }
 
         const Real &ux = w0_(m,IVX,k,j,i);
         const Real &uy = w0_(m,IVY,k,j,i);
@@ -414,8 +423,8 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
     });
   }
 
-  // Add resistive electric field (if needed)
-  if (presist != nullptr) {
+  // Add resistive electric field (if needed, and not integrated separately with STS)
+  if ((presist != nullptr) && !(pmy_pack->pmesh->use_sts)) {
     if (presist->eta_ohm > 0.0) {
       presist->OhmicEField(b0, efld);
     }
@@ -51,6 +51,18 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
   const int nkji = nx3*nx2*nx1;
   const int nji  = nx2*nx1;
 
+  // timesteps for conduction and cooling are computed in the same kernel as the
+  // fluid timestep (except in kinematic problems)
+  bool cond_dt = (pcond != nullptr) && !(pcond->sat_hflux);
+  bool src_dt = (psrc != nullptr) &&
+                ((psrc->ism_cooling && !(psrc->ism_cooling_exact)) || psrc->rel_cooling);
+  CondDtData cond_data = {};
+  CoolingDtData src_data = {};
+  if (cond_dt) {cond_data = pcond->GetDtData(peos->eos_data);}
+  if (src_dt) {src_data = psrc->GetDtData(peos->eos_data);}
+  Real dtc = std::numeric_limits<float>::max();
+  Real dts = std::numeric_limits<float>::max();
+
   if (pdriver->time_evolution == TimeEvolution::kinematic) {
     // find smallest (dx/v) in each direction for advection problems
     Kokkos::parallel_reduce("MHDNudt1",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
@@ -72,7 +84,8 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
     auto &bcc0_ = bcc0;
 
     Kokkos::parallel_reduce("MHDNudt2",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-    KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3) {
+    KOKKOS_LAMBDA(const int &idx, Real &min_dt1, Real &min_dt2, Real &min_dt3,
+                  Real &min_dtc, Real &min_dts) {
       // compute m,k,j,i indices of thread and call function
       int m = (idx)/nkji;
       int k = (idx - m*nkji)/nji;
@@ -145,7 +158,16 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
       min_dt1 = fmin((mbsize.d_view(m).dx1/max_dv1), min_dt1);
       min_dt2 = fmin((mbsize.d_view(m).dx2/max_dv2), min_dt2);
       min_dt3 = fmin((mbsize.d_view(m).dx3/max_dv3), min_dt3);
-    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2),Kokkos::Min<Real>(dt3));
+
+      if (cond_dt) {
+        min_dtc = fmin(CondCellNewDt(cond_data, w0_, m, k, j, i, mbsize.d_view(m).dx1,
+                       mbsize.d_view(m).dx2, mbsize.d_view(m).dx3), min_dtc);
+      }
+      if (src_dt) {
+        min_dts = fmin(CoolingCellNewDt(src_data, w0_, m, k, j, i), min_dts);
+      }
+    }, Kokkos::Min<Real>(dt1), Kokkos::Min<Real>(dt2), Kokkos::Min<Real>(dt3),
+       Kokkos::Min<Real>(dtc), Kokkos::Min<Real>(dts));
   }
 
   // compute minimum of dt1/dt2/dt3 for 1D/2D/3D problems
@@ -153,13 +175,22 @@ TaskStatus MHD::NewTimeStep(Driver *pdriver, int stage) {
   if (pmy_pack->pmesh->multi_d) { dtnew = std::min(dtnew, dt2); }
   if (pmy_pack->pmesh->three_d) { dtnew = std::min(dtnew, dt3); }
 
-  // compute timestep for diffusion
-  if (pcond != nullptr) {
-    pcond->NewTimeStep(w0, peos->eos_data);
-  }
-  // compute source terms timestep
-  if (psrc != nullptr) {
-    psrc->NewTimeStep(w0, peos->eos_data);
+  if (pdriver->time_evolution == TimeEvolution::kinematic) {
+    // compute timestep for diffusion
+    if (pcond != nullptr) {
+      pcond->NewTimeStep(w0, peos->eos_data);
+    }
+    // compute source terms timestep
+    if (psrc != nullptr) {
+      psrc->NewTimeStep(w0, peos->eos_data);
+    }
+  } else {
+    if (pcond != nullptr) {
+      pcond->dtnew = (cond_dt) ? cond_data.fac*dtc : dtc;
+    }
+    if (psrc != nullptr) {
+      psrc->dtnew = dts;
+    }
   }
 
   return TaskStatus::complete;
@@ -0,0 +1,228 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file mhd_sts.cpp
+//! \brief Task list functions for the super-time-stepping (STS) integration of diffusion
+//! terms (viscosity, Ohmic resistivity, thermal conduction) in MHD.  The STS stages are
+//! run by Driver::ExecuteSTS() using the RKL2 weights stored in the Driver.  The
+//! registers u1/b1 (unused outside of the stages of the time integrator) store Y_{j-2},
+//! while u_sts/b_sts and du_sts/db_sts store Y_0 and dt*M(Y_0).
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/resistivity.hpp"
+#include "diffusion/conduction.hpp"
+#include "mhd.hpp"
+
+namespace mhd {
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::STSFluxes
+//! \brief Computes fluxes of conserved variables due to diffusion terms only
+
+TaskStatus MHD::STSFluxes(Driver *pdrive, int stage) {
+  Kokkos::deep_copy(DevExeSpace(), uflx.x1f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x2f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x3f, 0.0);
+  if (pvisc != nullptr) {
+    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+  }
+  if ((presist != nullptr) && (peos->eos_data.is_ideal)) {
+    presist->OhmicEnergyFlux(b0, uflx);
+  }
+  if (pcond != nullptr) {
+    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::STSEField
+//! \brief Computes edge-centered electric fields due to diffusion terms only
+
+TaskStatus MHD::STSEField(Driver *pdrive, int stage) {
+  Kokkos::deep_copy(DevExeSpace(), efld.x1e, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), efld.x2e, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), efld.x3e, 0.0);
+  if (presist != nullptr) {
+    if (presist->eta_ohm > 0.0) {
+      presist->OhmicEField(b0, efld);
+    }
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::STSUpdate
+//! \brief Updates conserved variables and face-centered fields for one stage of the RKL2
+//! STS integrator, see Driver::ExecuteSTS()
+
+TaskStatus MHD::STSUpdate(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  bool first_stage = (stage == 1);
+  Real mu = pdrive->sts_mu[stage-1];
+  Real nu = pdrive->sts_nu[stage-1];
+  Real mu_twid = pdrive->sts_mu_twid[stage-1];
+  Real gam_twid = pdrive->sts_gam_twid[stage-1];
+  Real dt = pdrive->sts_dt;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nvar = nmhd + nscalars;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto us_ = u_sts;
+  auto dus_ = du_sts;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
+  //---- update conserved variables
+  int scr_level = 0;
+  size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
+
+  par_for_outer("mhd_sts",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
+
+    // compute dF1/dx1
+    par_for_inner(member, is, ie, [&](const int i) {
+      divf(i) = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+    });
+    member.team_barrier();
+
+    // Add dF2/dx2
+    if (multi_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      });
+      member.team_barrier();
+    }
+
+    // Add dF3/dx3
+    if (three_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      });
+      member.team_barrier();
+    }
+
+    par_for_inner(member, is, ie, [&](const int i) {
+      Real du = -dt*divf(i);
+      Real y = u0_(m,n,k,j,i);
+      if (first_stage) {
+        us_(m,n,k,j,i) = y;
+        dus_(m,n,k,j,i) = du;
+        u0_(m,n,k,j,i) = y + mu_twid*du;
+      } else {
+        u0_(m,n,k,j,i) = mu*y + nu*u1_(m,n,k,j,i) + (1.0 - mu - nu)*us_(m,n,k,j,i)
+                         + mu_twid*du + gam_twid*dus_(m,n,k,j,i);
+      }
+      u1_(m,n,k,j,i) = y;
+    });
+  });
+
+  //---- update face-centered fields using dB = -dt*Curl(E), as in MHD::CT()
+  auto e1 = efld.x1e;
+  auto e2 = efld.x2e;
+  auto e3 = efld.x3e;
+
+  // B1 (only changes in 2D/3D problems)
+  if (multi_d) {
+    auto bx1f = b0.x1f;
+    auto bx1f_old = b1.x1f;
+    auto bx1f_sts = b_sts.x1f;
+    auto dbx1f_sts = db_sts.x1f;
+    par_for("sts-b1", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie+1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real db = -dt*(e3(m,k,j+1,i) - e3(m,k,j,i))/mbsize.d_view(m).dx2;
+      if (three_d) {
+        db += dt*(e2(m,k+1,j,i) - e2(m,k,j,i))/mbsize.d_view(m).dx3;
+      }
+      Real y = bx1f(m,k,j,i);
+      if (first_stage) {
+        bx1f_sts(m,k,j,i) = y;
+        dbx1f_sts(m,k,j,i) = db;
+        bx1f(m,k,j,i) = y + mu_twid*db;
+      } else {
+        bx1f(m,k,j,i) = mu*y + nu*bx1f_old(m,k,j,i) + (1.0 - mu - nu)*bx1f_sts(m,k,j,i)
+                        + mu_twid*db + gam_twid*dbx1f_sts(m,k,j,i);
+      }
+      bx1f_old(m,k,j,i) = y;
+    });
+  }
+
+  // B2
+  auto bx2f = b0.x2f;
+  auto bx2f_old = b1.x2f;
+  auto bx2f_sts = b_sts.x2f;
+  auto dbx2f_sts = db_sts.x2f;
+  par_for("sts-b2", DevExeSpace(), 0, nmb1, ks, ke, js, je+1, is, ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real db = dt*(e3(m,k,j,i+1) - e3(m,k,j,i))/mbsize.d_view(m).dx1;
+    if (three_d) {
+      db -= dt*(e1(m,k+1,j,i) - e1(m,k,j,i))/mbsize.d_view(m).dx3;
+    }
+    Real y = bx2f(m,k,j,i);
+    if (first_stage) {
+      bx2f_sts(m,k,j,i) = y;
+      dbx2f_sts(m,k,j,i) = db;
+      bx2f(m,k,j,i) = y + mu_twid*db;
+    } else {
+      bx2f(m,k,j,i) = mu*y + nu*bx2f_old(m,k,j,i) + (1.0 - mu - nu)*bx2f_sts(m,k,j,i)
+                      + mu_twid*db + gam_twid*dbx2f_sts(m,k,j,i);
+    }
+    bx2f_old(m,k,j,i) = y;
+  });
+
+  // B3
+  auto bx3f = b0.x3f;
+  auto bx3f_old = b1.x3f;
+  auto bx3f_sts = b_sts.x3f;
+  auto dbx3f_sts = db_sts.x3f;
+  par_for("sts-b3", DevExeSpace(), 0, nmb1, ks, ke+1, js, je, is, ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real db = -dt*(e2(m,k,j,i+1) - e2(m,k,j,i))/mbsize.d_view(m).dx1;
+    if (multi_d) {
+      db += dt*(e1(m,k,j+1,i) - e1(m,k,j,i))/mbsize.d_view(m).dx2;
+    }
+    Real y = bx3f(m,k,j,i);
+    if (first_stage) {
+      bx3f_sts(m,k,j,i) = y;
+      dbx3f_sts(m,k,j,i) = db;
+      bx3f(m,k,j,i) = y + mu_twid*db;
+    } else {
+      bx3f(m,k,j,i) = mu*y + nu*bx3f_old(m,k,j,i) + (1.0 - mu - nu)*bx3f_sts(m,k,j,i)
+                      + mu_twid*db + gam_twid*dbx3f_sts(m,k,j,i);
+    }
+    bx3f_old(m,k,j,i) = y;
+  });
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::STSConToPrim
+//! \brief Computes primitives over entire mesh (including gz) after each STS stage.
+//! Differs from ConToPrim() only in that no operator split source terms are applied.
+
+TaskStatus MHD::STSConToPrim(Driver *pdrive, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1m1 = indcs.nx1 + 2*ng - 1;
+  int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
+  int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
+  peos->ConsToPrim(u0, b0, w0, bcc0, false, 0, n1m1, 0, n2m1, 0, n3m1);
+  return TaskStatus::complete;
+}
+} // namespace mhd
@@ -39,47 +39,131 @@ void MHD::AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl)
   TaskID none(0);
 
   // assemble "before_timeintegrator" task list
-  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none);
+  id.savest = tl["before_timeintegrator"]->AddTask(&MHD::SaveMHDState, this, none,
+                                                   "MHD::SaveMHDState");
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&MHD::InitRecv, this, none,
+                                          "MHD::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr);
-  id.efld      = tl["stagen"]->AddTask(&MHD::CornerE, this, id.recvu_shr);
-  id.efldsrc   = tl["stagen"]->AddTask(&MHD::EFieldSrc, this, id.efld);
-  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efldsrc);
-  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende);
-  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve);
-  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct);
-  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa);
-  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa);
-  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb);
-  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb);
-  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb);
-  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr);
-  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr);
-  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&MHD::CopyCons, this, none,
+                                       "MHD::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&MHD::Fluxes, this, id.copyu,
+                                       "MHD::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&MHD::SendFlux, this, id.flux,
+                                       "MHD::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&MHD::RecvFlux, this, id.sendf,
+                                       "MHD::RecvFlux");
+  id.rkupdt    = tl["stagen"]->AddTask(&MHD::RKUpdate, this, id.recvf,
+                                       "MHD::RKUpdate");
+  id.srctrms   = tl["stagen"]->AddTask(&MHD::MHDSrcTerms, this, id.rkupdt,
+                                       "MHD::MHDSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&MHD::SendU_OA, this, id.srctrms,
+                                       "MHD::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&MHD::RecvU_OA, this, id.sendu_oa,
+                                       "MHD::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&MHD::RestrictU, this, id.recvu_oa,
+                                       "MHD::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&MHD::SendU, this, id.restu,
+                                       "MHD::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&MHD::RecvU, this, id.sendu,
+                                       "MHD::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&MHD::SendU_Shr, this, id.recvu,
+                                       "MHD::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&MHD::RecvU_Shr, this, id.sendu_shr,
+                                       "MHD::RecvU_Shr");
+  id.efld      = tl["stagen"]->AddTask(&MHD::CornerE, this, id.recvu_shr,
+                                       "MHD::CornerE");
+  id.efldsrc   = tl["stagen"]->AddTask(&MHD::EFieldSrc, this, id.efld,
+                                       "MHD::EFieldSrc");
+  id.sende     = tl["stagen"]->AddTask(&MHD::SendE, this, id.efldsrc,
+                                       "MHD::SendE");
+  id.recve     = tl["stagen"]->AddTask(&MHD::RecvE, this, id.sende,
+                                       "MHD::RecvE");
+  id.ct        = tl["stagen"]->AddTask(&MHD::CT, this, id.recve,
+                                       "MHD::CT");
+  id.sendb_oa  = tl["stagen"]->AddTask(&MHD::SendB_OA, this, id.ct,
+                                       "MHD::SendB_OA");
+  id.recvb_oa  = tl["stagen"]->AddTask(&MHD::RecvB_OA, this, id.sendb_oa,
+                                       "MHD::RecvB_OA");
+  id.restb     = tl["stagen"]->AddTask(&MHD::RestrictB, this, id.recvb_oa,
+                                       "MHD::RestrictB");
+  id.sendb     = tl["stagen"]->AddTask(&MHD::SendB, this, id.restb,
+                                       "MHD::SendB");
+  id.recvb     = tl["stagen"]->AddTask(&MHD::RecvB, this, id.sendb,
+                                       "MHD::RecvB");
+  id.sendb_shr = tl["stagen"]->AddTask(&MHD::SendB_Shr, this, id.recvb,
+                                       "MHD::SendB_Shr");
+  id.recvb_shr = tl["stagen"]->AddTask(&MHD::RecvB_Shr, this, id.sendb_shr,
+                                       "MHD::RecvB_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.recvb_shr,
+                                       "MHD::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&MHD::Prolongate, this, id.bcs,
+                                       "MHD::Prolongate");
+  id.c2p       = tl["stagen"]->AddTask(&MHD::ConToPrim, this, id.prol,
+                                       "MHD::ConToPrim");
+  id.newdt     = tl["stagen"]->AddTask(&MHD::NewTimeStep, this, id.c2p,
+                                       "MHD::NewTimeStep");
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&MHD::ClearSend, this, none,
+                                         "MHD::ClearSend");
   // although RecvFlux/U/E/B functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&MHD::ClearRecv, this, id.csend,
+                                         "MHD::ClearRecv");
+
+  // assemble "before_sts", "sts", and "after_sts" task lists used to integrate
+  // diffusion terms with super-time-stepping.  See Driver::ExecuteSTS()
+  if (pmy_pack->pmesh->use_sts) {
+    if ((porb_u != nullptr) || (psbox_u != nullptr)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Super-time-stepping cannot be used with shearing box"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    id.sts_irecv = tl["before_sts"]->AddTask(&MHD::InitRecv, this, none,
+                                             "MHD::InitRecv");
+
+    id.sts_flux  = tl["sts"]->AddTask(&MHD::STSFluxes, this, none,
+                                      "MHD::STSFluxes");
+    id.sts_sendf = tl["sts"]->AddTask(&MHD::SendFlux, this, id.sts_flux,
+                                      "MHD::SendFlux");
+    id.sts_recvf = tl["sts"]->AddTask(&MHD::RecvFlux, this, id.sts_sendf,
+                                      "MHD::RecvFlux");
+    id.sts_efld  = tl["sts"]->AddTask(&MHD::STSEField, this, id.sts_recvf,
+                                      "MHD::STSEField");
+    id.sts_sende = tl["sts"]->AddTask(&MHD::SendE, this, id.sts_efld,
+                                      "MHD::SendE");
+    id.sts_recve = tl["sts"]->AddTask(&MHD::RecvE, this, id.sts_sende,
+                                      "MHD::RecvE");
+    id.sts_updt  = tl["sts"]->AddTask(&MHD::STSUpdate, this, id.sts_recve,
+                                      "MHD::STSUpdate");
+    id.sts_restu = tl["sts"]->AddTask(&MHD::RestrictU, this, id.sts_updt,
+                                      "MHD::RestrictU");
+    id.sts_sendu = tl["sts"]->AddTask(&MHD::SendU, this, id.sts_restu,
+                                      "MHD::SendU");
+    id.sts_recvu = tl["sts"]->AddTask(&MHD::RecvU, this, id.sts_sendu,
+                                      "MHD::RecvU");
+    id.sts_restb = tl["sts"]->AddTask(&MHD::RestrictB, this, id.sts_recvu,
+                                      "MHD::RestrictB");
+    id.sts_sendb = tl["sts"]->AddTask(&MHD::SendB, this, id.sts_restb,
+                                      "MHD::SendB");
+    id.sts_recvb = tl["sts"]->AddTask(&MHD::RecvB, this, id.sts_sendb,
+                                      "MHD::RecvB");
+    id.sts_bcs   = tl["sts"]->AddTask(&MHD::ApplyPhysicalBCs, this, id.sts_recvb,
+                                      "MHD::ApplyPhysicalBCs");
+    id.sts_prol  = tl["sts"]->AddTask(&MHD::Prolongate, this, id.sts_bcs,
+                                      "MHD::Prolongate");
+    id.sts_c2p   = tl["sts"]->AddTask(&MHD::STSConToPrim, this, id.sts_prol,
+                                      "MHD::STSConToPrim");
+
+    id.sts_csend = tl["after_sts"]->AddTask(&MHD::ClearSend, this, none,
+                                            "MHD::ClearSend");
+    id.sts_crecv = tl["after_sts"]->AddTask(&MHD::ClearRecv, this, id.sts_csend,
+                                            "MHD::ClearRecv");
+  }
 
   return;
 }
@@ -195,15 +279,17 @@ TaskStatus MHD::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<MHD_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, resistive, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
-  }
-  if ((presist != nullptr) && (peos->eos_data.is_ideal)) {
-    presist->OhmicEnergyFlux(b0, uflx);
-  }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  // Add viscous, resistive, heat-flux, etc fluxes (unless integrated separately with STS)
+  if (!(pmy_pack->pmesh->use_sts)) {
+    if (pvisc != nullptr) {
+      pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+    }
+    if ((presist != nullptr) && (peos->eos_data.is_ideal)) {
+      presist->OhmicEnergyFlux(b0, uflx);
+    }
+    if (pcond != nullptr) {
+      pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+    }
   }
 
   // call FOFC if necessary
@@ -542,6 +628,10 @@ TaskStatus MHD::ConToPrim(Driver *pdrive, int stage) {
   int n2m1 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng - 1) : 0;
   int n3m1 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng - 1) : 0;
   peos->ConsToPrim(u0, b0, w0, bcc0, false, 0, n1m1, 0, n2m1, 0, n3m1);
+  // exact ISM cooling is operator split, and applied once per step after the last stage
+  if ((psrc != nullptr) && psrc->ism_cooling_exact && (stage == pdrive->nexp_stages)) {
+    psrc->ISMCoolingExact(w0, peos->eos_data, pmy_pack->pmesh->dt, u0);
+  }
   return TaskStatus::complete;
 }
 
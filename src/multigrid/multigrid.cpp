@@ -0,0 +1,736 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file multigrid.cpp
+//! \brief Implements functions in Multigrid class that operate on the block levels, i.e.
+//! on the data stored in each MeshBlock coarsened by factors of two down to one cell.
+//!
+//! All block levels use a cell-centered second-order (3/5/7-point) Laplacian, red-black
+//! Gauss-Seidel smoothing, restriction by averaging the 2^dim fine cells, and
+//! bi/trilinear prolongation.  On each block level the ghost cells (faces only) are
+//! filled by Exchange().  Across fine/coarse boundaries (SMR/AMR) the ghost cells are
+//! set so that the flux through the interface computed on the coarse block equals the
+//! area-weighted average of the fluxes computed on the fine blocks, which ensures the
+//! discrete operator is conservative (and so the periodic problem remains solvable).
+//! At physical (non-periodic) boundaries, u=0 is imposed.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "mesh/nghbr_index.hpp"
+#include "bvals/bvals.hpp"
+#include "multigrid.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn void MGFaceCell()
+//! \brief returns (k,j,i) indices of the cell at normal index p and tangential indices
+//! (a,b) on a face with normal in direction 'dir'.  The tangential directions of x1-,
+//! x2-, and x3-faces are (x2,x3), (x1,x3), and (x1,x2) respectively, the same ordering
+//! used for the subfaces in NeighborIndex().
+
+KOKKOS_INLINE_FUNCTION
+void MGFaceCell(const int dir, const int p, const int a, const int b, const int js,
+                const int ks, int &k, int &j, int &i) {
+  if (dir == 0) {
+    i = p; j = js + a; k = ks + b;
+  } else if (dir == 1) {
+    i = 1 + a; j = p; k = ks + b;
+  } else {
+    i = 1 + a; j = js + b; k = p;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int MGMessageSize()
+//! \brief number of values sent across one (sub)face between two MeshBlocks on a block
+//! level with n cells per direction: the entire face with a neighbor at the same level
+//! or from a coarse to a fine block (one value per fine ghost cell), but only one value
+//! per coarse cell (i.e. per 2x2 fine cells) from a fine to a coarse block
+
+KOKKOS_INLINE_FUNCTION
+int MGMessageSize(const int dir, const int n, const bool fine_to_coarse,
+                  const bool multi_d, const bool three_d) {
+  int nt1 = (dir == 0)? (multi_d? n : 1) : n;
+  int nt2 = (dir == 2)? n : (three_d? n : 1);
+  if (!(fine_to_coarse)) return nt1*nt2;
+  return ((nt1 > 1)? nt1/2 : 1)*((nt2 > 1)? nt2/2 : 1);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real MGTangentialSlope()
+//! \brief difference between adjacent cells (centered, or one-sided at the edges of the
+//! face) of array 'a' in a tangential direction of a face, at tangential index t of nt
+
+KOKKOS_INLINE_FUNCTION
+Real MGTangentialSlope(const DvceArray5D<Real> &a, const int m, const int k,
+                       const int j, const int i, const int dk, const int dj,
+                       const int di, const int t, const int nt) {
+  if (nt < 2) return 0.0;
+  int tp = (t < nt-1)? 1 : 0;
+  int tm = (t > 0)? 1 : 0;
+  return (a(m,0,k+tp*dk,j+tp*dj,i+tp*di) - a(m,0,k-tm*dk,j-tm*dj,i-tm*di))/
+         static_cast<Real>(tp + tm);
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+// constructor, parses input parameters and allocates arrays on all block levels
+
+Multigrid::Multigrid(MeshBlockPack *pp, ParameterInput *pin, std::string block) :
+    pmy_pack(pp) {
+  Mesh *pm = pp->pmesh;
+  auto &indcs = pm->mb_indcs;
+  nx = indcs.nx1;
+  if ((pm->multi_d && indcs.nx2 != nx) || (pm->three_d && indcs.nx3 != nx) ||
+      ((nx & (nx - 1)) != 0)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Multigrid requires MeshBlocks with the same number of cells in each "
+              << "direction, which must be a power of 2" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // only periodic and u=0 (all other) BCs are implemented at physical boundaries
+  singular = true;
+  for (int d=0; d<3; ++d) {
+    periodic[d] = (pm->mesh_bcs[2*d] == BoundaryFlag::periodic);
+    bool active = (d == 0) || (d == 1 && pm->multi_d) || (d == 2 && pm->three_d);
+    if (active && (pm->mesh_bcs[2*d] == BoundaryFlag::shear_periodic ||
+                   pm->mesh_bcs[2*d+1] == BoundaryFlag::shear_periodic)) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Multigrid does not support shearing box boundaries"
+                << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    if (active && !(periodic[d])) {singular = false;}
+  }
+
+  threshold = pin->GetOrAddReal(block, "mg_threshold", 1.0e-6);
+  max_iterations = pin->GetOrAddInteger(block, "mg_max_iterations", 20);
+  npresmooth = pin->GetOrAddInteger(block, "mg_npresmooth", 1);
+  npostsmooth = pin->GetOrAddInteger(block, "mg_npostsmooth", 1);
+  niterations = 0;
+  defect_norm = 0.0;
+  src_norm = 0.0;
+  conv_factor = 0.0;
+
+  // allocate arrays on each block level, with one ghost cell in each active direction
+  nlevels = 1;
+  while ((nx >> (nlevels - 1)) > 1) {nlevels++;}
+  int nmb = std::max((pp->nmb_thispack), (pm->nmb_maxperrank));
+  u.resize(nlevels);
+  src.resize(nlevels);
+  def.resize(nlevels);
+  for (int l=0; l<nlevels; ++l) {
+    int n = nx >> l;
+    int n1 = n + 2;
+    int n2 = (pm->multi_d)? (n + 2) : 1;
+    int n3 = (pm->three_d)? (n + 2) : 1;
+    Kokkos::realloc(u[l], nmb, 1, n3, n2, n1);
+    Kokkos::realloc(src[l], nmb, 1, n3, n2, n1);
+    Kokkos::realloc(def[l], nmb, 1, n3, n2, n1);
+  }
+  // vectors are not resized after this point, so references to elements remain valid
+  for (int l=0; l<nlevels; ++l) {
+    pm->pmb_pool->Register(u[l]);
+    pm->pmb_pool->Register(src[l]);
+    pm->pmb_pool->Register(def[l]);
+  }
+
+  // buffers for ghost cell exchange, indexed by face neighbor slot = 4*face + subface
+  nslot = (pm->one_d)? 8 : ((pm->two_d)? 16 : 24);
+  int nbuf = (pm->three_d)? nx*nx : ((pm->multi_d)? nx : 1);
+  Kokkos::realloc(sbuf, nmb, nslot, nbuf);
+  Kokkos::realloc(rbuf, nmb, nslot, nbuf);
+  pm->pmb_pool->Register(sbuf);
+  pm->pmb_pool->Register(rbuf);
+
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm_dup(MPI_COMM_WORLD, &mg_comm);
+#endif
+
+  InitRootGrid();
+}
+
+//----------------------------------------------------------------------------------------
+// destructor
+
+Multigrid::~Multigrid() {
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm_free(&mg_comm);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::Solve()
+//! \brief Solves Lap(u[0]) = src[0].  The source on the finest level must be set by the
+//! caller.  Uses a full multigrid (FMG) cycle to compute the initial guess, followed by
+//! V-cycles until the volume-weighted RMS of the defect is smaller than threshold times
+//! that of the source (or max_iterations is reached).  With all boundaries periodic, the
+//! mean of the source is subtracted, and the solution has zero mean.  On exit the ghost
+//! cells of u[0] are set.
+
+void Multigrid::Solve() {
+  UpdateBlockData();
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+
+  if (singular) {
+    Real mean = Mean(0, src[0]);
+    auto src_ = src[0];
+    par_for("mg_submean", DevExeSpace(), 0, nmb1, 0, src_.extent_int(2)-1,
+            0, src_.extent_int(3)-1, 0, src_.extent_int(4)-1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      src_(m,0,k,j,i) -= mean;
+    });
+  }
+
+  // FMG cycle to set initial guess
+  for (int l=0; l<nlevels-1; ++l) {
+    Restrict(l, src[l], src[l+1]);
+  }
+  VCycle(nlevels-1);
+  for (int l=nlevels-2; l>=0; --l) {
+    Exchange(l+1, u[l+1]);
+    Prolongate(l, false);
+    VCycle(l);
+  }
+
+  // iterate V-cycles until converged
+  src_norm = Norm(0, src[0]);
+  Exchange(0, u[0]);
+  CalculateDefect(0);
+  defect_norm = Norm(0, def[0]);
+  Real defect_fmg = defect_norm;
+  niterations = 0;
+  while ((defect_norm > threshold*src_norm) && (niterations < max_iterations)) {
+    VCycle(0);
+    niterations++;
+    Exchange(0, u[0]);
+    CalculateDefect(0);
+    defect_norm = Norm(0, def[0]);
+  }
+  conv_factor = 0.0;
+  if (niterations > 0 && defect_fmg > 0.0) {
+    conv_factor = std::pow(defect_norm/defect_fmg, 1.0/static_cast<Real>(niterations));
+  }
+
+  // solution of singular problem is defined up to a constant, set mean to zero
+  if (singular) {
+    Real mean = Mean(0, u[0]);
+    auto u_ = u[0];
+    par_for("mg_umean", DevExeSpace(), 0, nmb1, 0, u_.extent_int(2)-1,
+            0, u_.extent_int(3)-1, 0, u_.extent_int(4)-1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      u_(m,0,k,j,i) -= mean;
+    });
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::VCycle()
+//! \brief Performs one V-cycle starting (and ending) on block level l0, using u[l0] as
+//! the initial guess.  Below l0 the corrections are computed starting from zero.  On the
+//! coarsest block level the problem is solved using the root grid.  With SMR/AMR the
+//! coarsest block level is also smoothed, since MeshBlocks finer than the root level are
+//! further coarsened on the root grid.
+
+void Multigrid::VCycle(int l0) {
+  int lb = nlevels - 1;
+  for (int l=l0; l<lb; ++l) {
+    if (l > l0) {Kokkos::deep_copy(DevExeSpace(), u[l], 0.0);}
+    Smooth(l, npresmooth, (l > l0));
+    Exchange(l, u[l]);
+    CalculateDefect(l);
+    Restrict(l, def[l], src[l+1]);
+  }
+
+  Kokkos::deep_copy(DevExeSpace(), u[lb], 0.0);
+  if (pmy_pack->pmesh->multilevel) {
+    Smooth(lb, npresmooth, true);
+    Exchange(lb, u[lb]);
+    CalculateDefect(lb);
+    SolveRootGrid(def[lb]);
+    Smooth(lb, npostsmooth, false);
+  } else {
+    SolveRootGrid(src[lb]);
+  }
+
+  for (int l=lb-1; l>=l0; --l) {
+    Exchange(l+1, u[l+1]);
+    Prolongate(l, true);
+    Smooth(l, npostsmooth, false);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::Smooth()
+//! \brief nsweep red-black Gauss-Seidel sweeps on block level l.  Ghost cells are
+//! exchanged before each color, except before the first if u=0 (zero_guess=true).
+
+void Multigrid::Smooth(int l, int nsweep, bool zero_guess) {
+  for (int s=0; s<nsweep; ++s) {
+    if (s > 0 || !(zero_guess)) {Exchange(l, u[l]);}
+    SmoothColor(l, 0);
+    Exchange(l, u[l]);
+    SmoothColor(l, 1);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::SmoothColor()
+//! \brief Gauss-Seidel update of cells of one color on block level l.  On levels with
+//! one cell per block the color is set by the logical location of the block, so that
+//! the coloring is consistent across blocks on all levels.
+
+void Multigrid::SmoothColor(int l, int color) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> l;
+  int js = (pm->multi_d)? 1 : 0, je = (pm->multi_d)? n : 0;
+  int ks = (pm->three_d)? 1 : 0, ke = (pm->three_d)? n : 0;
+  bool multi_d = pm->multi_d, three_d = pm->three_d;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  Real fac = static_cast<Real>(1 << l);
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto par = mb_parity;
+  auto u_ = u[l];
+  auto src_ = src[l];
+
+  par_for("mg_smooth", DevExeSpace(), 0, nmb1, ks, ke, js, je, 1, n,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    int p = (n == 1)? par.d_view(m) : 0;
+    if (((i + j + k + p) & 1) != color) return;
+    Real idx1 = 1.0/SQR(fac*mbsize.d_view(m).dx1);
+    Real off = (u_(m,0,k,j,i+1) + u_(m,0,k,j,i-1))*idx1;
+    Real diag = 2.0*idx1;
+    if (multi_d) {
+      Real idx2 = 1.0/SQR(fac*mbsize.d_view(m).dx2);
+      off += (u_(m,0,k,j+1,i) + u_(m,0,k,j-1,i))*idx2;
+      diag += 2.0*idx2;
+    }
+    if (three_d) {
+      Real idx3 = 1.0/SQR(fac*mbsize.d_view(m).dx3);
+      off += (u_(m,0,k+1,j,i) + u_(m,0,k-1,j,i))*idx3;
+      diag += 2.0*idx3;
+    }
+    u_(m,0,k,j,i) = (off - src_(m,0,k,j,i))/diag;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::CalculateDefect()
+//! \brief def = src - Lap(u) on block level l.  Ghost cells of u must be set.
+
+void Multigrid::CalculateDefect(int l) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> l;
+  int js = (pm->multi_d)? 1 : 0, je = (pm->multi_d)? n : 0;
+  int ks = (pm->three_d)? 1 : 0, ke = (pm->three_d)? n : 0;
+  bool multi_d = pm->multi_d, three_d = pm->three_d;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  Real fac = static_cast<Real>(1 << l);
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto u_ = u[l];
+  auto src_ = src[l];
+  auto def_ = def[l];
+
+  par_for("mg_defect", DevExeSpace(), 0, nmb1, ks, ke, js, je, 1, n,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real uc = u_(m,0,k,j,i);
+    Real lap = (u_(m,0,k,j,i+1) - 2.0*uc + u_(m,0,k,j,i-1))/
+               SQR(fac*mbsize.d_view(m).dx1);
+    if (multi_d) {
+      lap += (u_(m,0,k,j+1,i) - 2.0*uc + u_(m,0,k,j-1,i))/SQR(fac*mbsize.d_view(m).dx2);
+    }
+    if (three_d) {
+      lap += (u_(m,0,k+1,j,i) - 2.0*uc + u_(m,0,k-1,j,i))/SQR(fac*mbsize.d_view(m).dx3);
+    }
+    def_(m,0,k,j,i) = src_(m,0,k,j,i) - lap;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::Restrict()
+//! \brief restricts array on block level l to level l+1 by averaging the 2^dim fine cells
+
+void Multigrid::Restrict(int l, DvceArray5D<Real> &fine, DvceArray5D<Real> &coarse) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> (l + 1);
+  int js = (pm->multi_d)? 1 : 0, je = (pm->multi_d)? n : 0;
+  int ks = (pm->three_d)? 1 : 0, ke = (pm->three_d)? n : 0;
+  bool multi_d = pm->multi_d, three_d = pm->three_d;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  Real wght = (three_d)? 0.125 : ((multi_d)? 0.25 : 0.5);
+  auto f = fine;
+  auto c = coarse;
+
+  par_for("mg_restrict", DevExeSpace(), 0, nmb1, ks, ke, js, je, 1, n,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    int fi = 2*i - 1;
+    int fj = (multi_d)? 2*j - 1 : 0;
+    int fk = (three_d)? 2*k - 1 : 0;
+    Real sum = f(m,0,fk,fj,fi) + f(m,0,fk,fj,fi+1);
+    if (multi_d) {
+      sum += f(m,0,fk,fj+1,fi) + f(m,0,fk,fj+1,fi+1);
+    }
+    if (three_d) {
+      sum += f(m,0,fk+1,fj,fi) + f(m,0,fk+1,fj,fi+1);
+      sum += f(m,0,fk+1,fj+1,fi) + f(m,0,fk+1,fj+1,fi+1);
+    }
+    c(m,0,k,j,i) = wght*sum;
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::Prolongate()
+//! \brief bi/trilinear prolongation of u[l+1] to block level l (ghost cells of u[l+1]
+//! must be set).  Only face ghost cells are exchanged, so coarse values at edge and
+//! corner ghost cells are linearly extrapolated from the face ghosts.  Prolongated
+//! values replace (add=false) or are added to (add=true) u[l].
+
+void Multigrid::Prolongate(int l, bool add) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> l;
+  int nc = n/2;
+  int js = (pm->multi_d)? 1 : 0, je = (pm->multi_d)? n : 0;
+  int ks = (pm->three_d)? 1 : 0, ke = (pm->three_d)? n : 0;
+  bool multi_d = pm->multi_d, three_d = pm->three_d;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  auto uf = u[l];
+  auto uc = u[l+1];
+
+  par_for("mg_prolong", DevExeSpace(), 0, nmb1, ks, ke, js, je, 1, n,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    int ci = (i + 1)/2;
+    int cj = (multi_d)? (j + 1)/2 : 0;
+    int ck = (three_d)? (k + 1)/2 : 0;
+    // offsets to coarse neighbors closest to fine cell, and whether they are ghosts
+    int oi = (i & 1)? -1 : 1;
+    int oj = (multi_d)? ((j & 1)? -1 : 1) : 0;
+    int ok = (three_d)? ((k & 1)? -1 : 1) : 0;
+    bool gi = (ci + oi < 1 || ci + oi > nc);
+    bool gj = (multi_d && (cj + oj < 1 || cj + oj > nc));
+    bool gk = (three_d && (ck + ok < 1 || ck + ok > nc));
+    Real val = 0.0;
+    for (int c=0; c<=abs(ok); ++c) {
+      for (int b=0; b<=abs(oj); ++b) {
+        for (int a=0; a<=1; ++a) {
+          // weights 3/4 and 1/4 in each active direction
+          Real w = (a? 0.25 : 0.75);
+          if (multi_d) {w *= (b? 0.25 : 0.75);}
+          if (three_d) {w *= (c? 0.25 : 0.75);}
+          // directions in which offset lands on a ghost cell
+          bool xi = (a && gi), xj = (b && gj), xk = (c && gk);
+          int nout = static_cast<int>(xi) + static_cast<int>(xj) + static_cast<int>(xk);
+          int di = a*oi, dj = b*oj, dk = c*ok;
+          Real uval;
+          if (nout <= 1) {
+            uval = uc(m,0,ck+dk,cj+dj,ci+di);
+          } else {
+            // edge/corner ghost: extrapolate using face ghosts (exact for linear u)
+            int di0 = xi? 0 : di, dj0 = xj? 0 : dj, dk0 = xk? 0 : dk;
+            uval = -(nout - 1)*uc(m,0,ck+dk0,cj+dj0,ci+di0);
+            if (xi) {uval += uc(m,0,ck+dk0,cj+dj0,ci+di);}
+            if (xj) {uval += uc(m,0,ck+dk0,cj+dj,ci+di0);}
+            if (xk) {uval += uc(m,0,ck+dk,cj+dj0,ci+di0);}
+          }
+          val += w*uval;
+        }
+      }
+    }
+    if (add) {
+      uf(m,0,k,j,i) += val;
+    } else {
+      uf(m,0,k,j,i) = val;
+    }
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real Multigrid::Norm()
+//! \brief volume-weighted RMS of array over all active cells on block level l
+
+Real Multigrid::Norm(int l, const DvceArray5D<Real> &a) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> l;
+  int n2 = (pm->multi_d)? n : 1, n3 = (pm->three_d)? n : 1;
+  int js = (pm->multi_d)? 1 : 0, ks = (pm->three_d)? 1 : 0;
+  int nmkji = (pmy_pack->nmb_thispack)*n3*n2*n;
+  int nkji = n3*n2*n;
+  int nji = n2*n;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto a_ = a;
+  Real sum_a2 = 0.0, sum_vol = 0.0;
+  Kokkos::parallel_reduce("mg_norm", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+  KOKKOS_LAMBDA(const int &idx, Real &s_a2, Real &s_vol) {
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/n;
+    int i = (idx - m*nkji - k*nji - j*n) + 1;
+    k += ks;
+    j += js;
+    Real vol = mbsize.d_view(m).dx1*mbsize.d_view(m).dx2*mbsize.d_view(m).dx3;
+    s_a2 += vol*SQR(a_(m,0,k,j,i));
+    s_vol += vol;
+  }, Kokkos::Sum<Real>(sum_a2), Kokkos::Sum<Real>(sum_vol));
+#if MPI_PARALLEL_ENABLED
+  Real sums[2] = {sum_a2, sum_vol};
+  MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_ATHENA_REAL, MPI_SUM, mg_comm);
+  sum_a2 = sums[0];
+  sum_vol = sums[1];
+#endif
+  return std::sqrt(sum_a2/sum_vol);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real Multigrid::Mean()
+//! \brief volume-weighted mean of array over all active cells on block level l
+
+Real Multigrid::Mean(int l, const DvceArray5D<Real> &a) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> l;
+  int n2 = (pm->multi_d)? n : 1, n3 = (pm->three_d)? n : 1;
+  int js = (pm->multi_d)? 1 : 0, ks = (pm->three_d)? 1 : 0;
+  int nmkji = (pmy_pack->nmb_thispack)*n3*n2*n;
+  int nkji = n3*n2*n;
+  int nji = n2*n;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto a_ = a;
+  Real sum_a = 0.0, sum_vol = 0.0;
+  Kokkos::parallel_reduce("mg_mean", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+  KOKKOS_LAMBDA(const int &idx, Real &s_a, Real &s_vol) {
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/n;
+    int i = (idx - m*nkji - k*nji - j*n) + 1;
+    k += ks;
+    j += js;
+    Real vol = mbsize.d_view(m).dx1*mbsize.d_view(m).dx2*mbsize.d_view(m).dx3;
+    s_a += vol*a_(m,0,k,j,i);
+    s_vol += vol;
+  }, Kokkos::Sum<Real>(sum_a), Kokkos::Sum<Real>(sum_vol));
+#if MPI_PARALLEL_ENABLED
+  Real sums[2] = {sum_a, sum_vol};
+  MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_ATHENA_REAL, MPI_SUM, mg_comm);
+  sum_a = sums[0];
+  sum_vol = sums[1];
+#endif
+  return sum_a/sum_vol;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::UpdateBlockData()
+//! \brief stores parity of logical location of each MeshBlock on device.  Called at the
+//! start of every solve since MeshBlocks may have changed with AMR.
+
+void Multigrid::UpdateBlockData() {
+  int nmb = pmy_pack->nmb_thispack;
+  if (static_cast<int>(mb_parity.extent(0)) < nmb) {
+    Kokkos::realloc(mb_parity, nmb);
+    Kokkos::realloc(mb_val, nmb);
+  }
+  for (int m=0; m<nmb; ++m) {
+    auto &lloc = pmy_pack->pmesh->lloc_eachmb[pmy_pack->gids + m];
+    mb_parity.h_view(m) = (lloc.lx1 + lloc.lx2 + lloc.lx3) & 1;
+  }
+  mb_parity.template modify<HostMemSpace>();
+  mb_parity.template sync<DevExeSpace>();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::Exchange()
+//! \brief fills ghost cells of array 'a' on block level l.  Each MeshBlock sends the
+//! first layer of active cells adjacent to each face to its neighbor(s), writing
+//! directly into the receive buffer of neighbors on the same rank.  Across fine/coarse
+//! interfaces, fine blocks send the average of each 2x2 (2 in 2D) patch of cells, and
+//! coarse blocks send the cells in the quadrant of the face touching the fine block,
+//! interpolated to the tangential positions of the fine ghost cells.
+//! Buffers use the face neighbor slots s=4*face+subface, related to the indices used in
+//! the MeshBlock neighbor list by NeighborIndex = (s < 16)? s : s+8.
+
+void Multigrid::Exchange(int l, DvceArray5D<Real> &a) {
+  auto &pm = pmy_pack->pmesh;
+  int n = nx >> l;
+  int nmb = pmy_pack->nmb_thispack;
+  int nmb1 = nmb - 1;
+  int nbuf = rbuf.extent_int(2);
+  int ns1 = nslot - 1;
+  int js = (pm->multi_d)? 1 : 0;
+  int ks = (pm->three_d)? 1 : 0;
+  bool multi_d = pm->multi_d, three_d = pm->three_d;
+  int myrank = global_variable::my_rank;
+  int gids = pmy_pack->gids;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  auto &mblev = pmy_pack->pmb->mb_lev;
+  auto a_ = a;
+  auto sbuf_ = sbuf;
+  auto rbuf_ = rbuf;
+
+#if MPI_PARALLEL_ENABLED
+  // post non-blocking receives for neighbors on other ranks
+  send_req.assign(nmb*nslot, MPI_REQUEST_NULL);
+  recv_req.assign(nmb*nslot, MPI_REQUEST_NULL);
+  for (int m=0; m<nmb; ++m) {
+    for (int s=0; s<nslot; ++s) {
+      auto &nb = nghbr.h_view(m, (s < 16)? s : s+8);
+      if (nb.gid >= 0 && nb.rank != myrank) {
+        int cnt = MGMessageSize(s/8, n, (nb.lev > mblev.h_view(m)), multi_d, three_d);
+        MPI_Irecv(Kokkos::subview(rbuf, m, s, Kokkos::ALL).data(), cnt, MPI_ATHENA_REAL,
+                  nb.rank, CreateBvals_MPI_Tag(m, s), mg_comm, &(recv_req[m*nslot + s]));
+      }
+    }
+  }
+#endif
+
+  // pack (and copy to MeshBlocks on this rank)
+  par_for("mg_pack", DevExeSpace(), 0, nmb1, 0, ns1, 0, nbuf-1,
+  KOKKOS_LAMBDA(int m, int s, int idx) {
+    auto nb = nghbr.d_view(m, (s < 16)? s : s+8);
+    if (nb.gid < 0) return;
+    int face = s/4, sub = s - 4*face;
+    int dir = face/2;
+    int p = (face & 1)? n : 1;
+    int nt1 = (dir == 0)? (multi_d? n : 1) : n;
+    int nt2 = (dir == 2)? n : (three_d? n : 1);
+    int h1 = (nt1 > 1)? nt1/2 : 1;
+    int h2 = (nt2 > 1)? nt2/2 : 1;
+    int mylev = mblev.d_view(m);
+    int k, j, i;
+    Real val;
+    if (nb.lev == mylev) {
+      if (idx >= nt1*nt2) return;
+      MGFaceCell(dir, p, idx % nt1, idx / nt1, js, ks, k, j, i);
+      val = a_(m,0,k,j,i);
+    } else if (nb.lev > mylev) {
+      // neighbor is finer: send cells in quadrant of face touching neighbor, linearly
+      // interpolated in the tangential directions to the center of each fine ghost cell
+      if (idx >= nt1*nt2) return;
+      int fa = idx % nt1, fb = idx / nt1;
+      int aa = (nt1 > 1)? (sub & 1)*h1 + fa/2 : 0;
+      int bb = (nt2 > 1)? (sub >> 1)*h2 + fb/2 : 0;
+      MGFaceCell(dir, p, aa, bb, js, ks, k, j, i);
+      int di1 = (dir == 0)? 0 : 1, dj1 = (dir == 0)? 1 : 0;
+      int dj2 = (dir == 2)? 1 : 0, dk2 = (dir == 2)? 0 : 1;
+      val = a_(m,0,k,j,i)
+          + 0.25*((fa & 1)? 1.0 : -1.0)*MGTangentialSlope(a_,m,k,j,i,0,dj1,di1,aa,nt1)
+          + 0.25*((fb & 1)? 1.0 : -1.0)*MGTangentialSlope(a_,m,k,j,i,dk2,dj2,0,bb,nt2);
+    } else {
+      // neighbor is coarser: send average over cells touching each coarse cell
+      if (idx >= h1*h2) return;
+      int ia = idx % h1, ib = idx / h1;
+      int na = (nt1 > 1)? 2 : 1, nb2 = (nt2 > 1)? 2 : 1;
+      val = 0.0;
+      for (int b=0; b<nb2; ++b) {
+        for (int c=0; c<na; ++c) {
+          MGFaceCell(dir, p, na*ia + c, nb2*ib + b, js, ks, k, j, i);
+          val += a_(m,0,k,j,i);
+        }
+      }
+      val /= static_cast<Real>(na*nb2);
+    }
+    if (nb.rank == myrank) {
+      int dn = nb.dest;
+      rbuf_(nb.gid - gids, (dn < 16)? dn : dn-8, idx) = val;
+    } else {
+      sbuf_(m,s,idx) = val;
+    }
+  });
+
+#if MPI_PARALLEL_ENABLED
+  // send to neighbors on other ranks
+  Kokkos::fence();
+  for (int m=0; m<nmb; ++m) {
+    for (int s=0; s<nslot; ++s) {
+      auto &nb = nghbr.h_view(m, (s < 16)? s : s+8);
+      if (nb.gid >= 0 && nb.rank != myrank) {
+        int cnt = MGMessageSize(s/8, n, (nb.lev < mblev.h_view(m)), multi_d, three_d);
+        int lid = nb.gid - pm->gids_eachrank[nb.rank];
+        int tag = CreateBvals_MPI_Tag(lid, (nb.dest < 16)? nb.dest : nb.dest-8);
+        MPI_Isend(Kokkos::subview(sbuf, m, s, Kokkos::ALL).data(), cnt, MPI_ATHENA_REAL,
+                  nb.rank, tag, mg_comm, &(send_req[m*nslot + s]));
+      }
+    }
+  }
+  MPI_Waitall(nmb*nslot, recv_req.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  // unpack into ghost cells, and apply u=0 at physical boundaries
+  int nface = (three_d)? 6 : ((multi_d)? 4 : 2);
+  int ntmax = (multi_d)? n : 1;
+  par_for("mg_unpack", DevExeSpace(), 0, nmb1, 0, nface-1, 0, ntmax-1, 0, ntmax-1,
+  KOKKOS_LAMBDA(int m, int face, int b, int a) {
+    int dir = face/2;
+    int nt1 = (dir == 0)? (multi_d? n : 1) : n;
+    int nt2 = (dir == 2)? n : (three_d? n : 1);
+    if (a >= nt1 || b >= nt2) return;
+    int h1 = (nt1 > 1)? nt1/2 : 1;
+    int h2 = (nt2 > 1)? nt2/2 : 1;
+    int mylev = mblev.d_view(m);
+    int s0 = 4*face;
+    int nbase = (s0 < 16)? s0 : s0+8;
+    int k, j, i, kg, jg, ig;
+    MGFaceCell(dir, ((face & 1)? n : 1), a, b, js, ks, k, j, i);
+    MGFaceCell(dir, ((face & 1)? n+1 : 0), a, b, js, ks, kg, jg, ig);
+    Real u1 = a_(m,0,k,j,i);
+
+    // classify neighbor(s) across this face
+    int ncoarse = -1, nfine = 0;
+    for (int sub=0; sub<4; ++sub) {
+      auto nb = nghbr.d_view(m, nbase + sub);
+      if (nb.gid >= 0) {
+        if (nb.lev < mylev) {ncoarse = sub;}
+        if (nb.lev > mylev) {nfine++;}
+      }
+    }
+    auto nb0 = nghbr.d_view(m, nbase);
+    Real ghost;
+    if (nb0.gid >= 0 && nb0.lev == mylev) {
+      ghost = rbuf_(m, s0, a + nt1*b);
+    } else if (ncoarse >= 0) {
+      // linear interpolation between coarse cell center and first fine cell
+      ghost = TWO_3RDS*rbuf_(m, s0 + ncoarse, a + nt1*b) + ONE_3RD*u1;
+    } else if (nfine > 0) {
+      // ghost such that coarse flux equals average of fine fluxes
+      Real avg = 0.0;
+      if (n > 1) {
+        int s1 = (nt1 > 1)? a/h1 : 0, s2 = (nt2 > 1)? b/h2 : 0;
+        avg = rbuf_(m, s0 + s1 + 2*s2, (a - s1*h1) + h1*(b - s2*h2));
+      } else {
+        for (int sub=0; sub<4; ++sub) {
+          if (nghbr.d_view(m, nbase + sub).gid >= 0) {avg += rbuf_(m, s0 + sub, 0);}
+        }
+        avg /= static_cast<Real>(nfine);
+      }
+      ghost = FOUR_3RDS*avg - ONE_3RD*u1;
+    } else {
+      ghost = -u1;
+    }
+    a_(m,0,kg,jg,ig) = ghost;
+  });
+
+#if MPI_PARALLEL_ENABLED
+  MPI_Waitall(nmb*nslot, send_req.data(), MPI_STATUSES_IGNORE);
+#endif
+  return;
+}
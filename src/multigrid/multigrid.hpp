@@ -0,0 +1,98 @@
+#ifndef MULTIGRID_MULTIGRID_HPP_
+#define MULTIGRID_MULTIGRID_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file multigrid.hpp
+//! \brief defines Multigrid class, a geometric multigrid solver for the Poisson equation
+//! Lap(u) = src on the (cell-centered) Mesh.  Each MeshBlock is coarsened by factors of
+//! two down to a single cell (block levels 0...nlevels-1), after which the one-cell
+//! values of all MeshBlocks are collected into a root grid with one cell per root-level
+//! MeshBlock that is solved (redundantly on every rank) by its own multigrid hierarchy.
+//! Ghost cells on each block level are exchanged across faces of neighboring MeshBlocks,
+//! with conservative (flux-matched) fine/coarse interface rules with SMR/AMR.
+
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "parameter_input.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \struct MGRootLevel
+//! \brief data for one level of the multigrid hierarchy of the root grid (host arrays
+//! with one ghost cell on each side in every direction)
+
+struct MGRootLevel {
+  int n1, n2, n3;
+  Real h1, h2, h3;
+  std::vector<Real> u, src, def;
+  int Index(int k, int j, int i) const {return (k*(n2 + 2) + j)*(n1 + 2) + i;}
+};
+
+//----------------------------------------------------------------------------------------
+//! \class Multigrid
+//! \brief geometric multigrid solver for Poisson equation over a MeshBlockPack
+
+class Multigrid {
+ public:
+  Multigrid(MeshBlockPack *pp, ParameterInput *pin, std::string block);
+  ~Multigrid();
+
+  // data
+  int nlevels;                  // number of block levels (finest = 0)
+  std::vector<DvceArray5D<Real>> u, src, def;  // solution, source, defect on each level
+  Real threshold;               // convergence criterion ||defect||/||src||
+  int max_iterations;           // maximum number of V-cycles after FMG
+  int npresmooth, npostsmooth;  // number of RBGS sweeps before/after coarse correction
+  bool singular;                // true if all BCs periodic (source must have zero mean)
+
+  // diagnostics of last solve
+  int niterations;              // number of V-cycles (after FMG)
+  Real defect_norm, src_norm;   // volume-weighted RMS of final defect and source
+  Real conv_factor;             // mean reduction of defect per V-cycle
+
+  // functions
+  void Solve();
+  Real Norm(int l, const DvceArray5D<Real> &a);
+  Real Mean(int l, const DvceArray5D<Real> &a);
+
+ private:
+  MeshBlockPack *pmy_pack;
+  int nx;                       // number of cells per dimension in MeshBlocks
+  bool periodic[3];             // periodic BCs in each direction
+  int nslot;                    // number of face neighbor slots per MeshBlock
+  DvceArray3D<Real> sbuf, rbuf; // send/receive buffers (m, slot, cell)
+  DualArray1D<int> mb_parity;   // parity of lx1+lx2+lx3 of each MB (used for coloring)
+  DualArray1D<Real> mb_val;     // one-cell value of each MB on coarsest block level
+  std::vector<MGRootLevel> root;  // multigrid hierarchy of the root grid
+#if MPI_PARALLEL_ENABLED
+  MPI_Comm mg_comm;             // communicator for ghost cell exchange
+  std::vector<MPI_Request> send_req, recv_req;
+#endif
+
+  // block level functions (multigrid.cpp)
+  void Exchange(int l, DvceArray5D<Real> &a);
+  void SmoothColor(int l, int color);
+  void Smooth(int l, int nsweep, bool zero_guess);
+  void CalculateDefect(int l);
+  void Restrict(int l, DvceArray5D<Real> &fine, DvceArray5D<Real> &coarse);
+  void Prolongate(int l, bool add);
+  void VCycle(int l0);
+  void UpdateBlockData();
+  // root grid functions (multigrid_root.cpp)
+  void InitRootGrid();
+  void SolveRootGrid(DvceArray5D<Real> &a);
+  void RootBoundary(MGRootLevel &r, std::vector<Real> &a);
+  void RootSmooth(MGRootLevel &r, int nsweep);
+  void RootDefect(MGRootLevel &r);
+  void RootRestrict(MGRootLevel &f, std::vector<Real> &a, MGRootLevel &c);
+  void RootProlongate(MGRootLevel &c, MGRootLevel &f, bool add);
+  void RootVCycle(int l0);
+  Real RootNorm(MGRootLevel &r, std::vector<Real> &a);
+};
+
+#endif // MULTIGRID_MULTIGRID_HPP_
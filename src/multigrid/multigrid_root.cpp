@@ -0,0 +1,374 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file multigrid_root.cpp
+//! \brief Implements functions in Multigrid class that operate on the root grid.  The
+//! root grid has one cell per MeshBlock at the root level (nmb_rootx1 x nmb_rootx2 x
+//! nmb_rootx3 cells).  It is filled with the one-cell values of all MeshBlocks on the
+//! coarsest block level (with MeshBlocks finer than the root level averaged into the
+//! root cell containing them), gathered on every rank, and then solved using a separate
+//! multigrid hierarchy on the host.  The root grid is coarsened as long as the number of
+//! cells in every direction is even; the coarsest level is solved by RBGS iteration.
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "multigrid.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::InitRootGrid()
+//! \brief allocates levels of root grid multigrid hierarchy
+
+void Multigrid::InitRootGrid() {
+  Mesh *pm = pmy_pack->pmesh;
+  auto &ms = pm->mesh_size;
+  MGRootLevel r;
+  r.n1 = pm->nmb_rootx1;
+  r.n2 = (pm->multi_d)? pm->nmb_rootx2 : 1;
+  r.n3 = (pm->three_d)? pm->nmb_rootx3 : 1;
+  r.h1 = (ms.x1max - ms.x1min)/static_cast<Real>(r.n1);
+  r.h2 = (ms.x2max - ms.x2min)/static_cast<Real>(r.n2);
+  r.h3 = (ms.x3max - ms.x3min)/static_cast<Real>(r.n3);
+  root.clear();
+  while (true) {
+    std::size_t size = (r.n1 + 2)*(r.n2 + 2)*(r.n3 + 2);
+    r.u.assign(size, 0.0);
+    r.src.assign(size, 0.0);
+    r.def.assign(size, 0.0);
+    root.push_back(r);
+    if ((r.n1 % 2 != 0) || (pm->multi_d && (r.n2 % 2 != 0)) ||
+        (pm->three_d && (r.n3 % 2 != 0))) break;
+    r.n1 /= 2;
+    r.h1 *= 2.0;
+    if (pm->multi_d) {r.n2 /= 2; r.h2 *= 2.0;}
+    if (pm->three_d) {r.n3 /= 2; r.h3 *= 2.0;}
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::SolveRootGrid()
+//! \brief Solves for the correction on the coarsest block level.  Collects array 'a'
+//! (the source or defect on the coarsest block level) into the root grid, solves the
+//! root grid, and adds the solution to u on the coarsest block level.  MeshBlocks finer
+//! than the root level receive the value at their center linearly interpolated from the
+//! root grid.
+
+void Multigrid::SolveRootGrid(DvceArray5D<Real> &a) {
+  Mesh *pm = pmy_pack->pmesh;
+  int nmb = pmy_pack->nmb_thispack;
+  int js = (pm->multi_d)? 1 : 0;
+  int ks = (pm->three_d)? 1 : 0;
+  int dim = 1 + static_cast<int>(pm->multi_d) + static_cast<int>(pm->three_d);
+  auto val = mb_val;
+  auto a_ = a;
+
+  // copy one-cell values of MeshBlocks to host
+  par_for("mg_gather", DevExeSpace(), 0, nmb-1,
+  KOKKOS_LAMBDA(int m) {
+    val.d_view(m) = a_(m,0,ks,js,1);
+  });
+  mb_val.template modify<DevExeSpace>();
+  mb_val.template sync<HostMemSpace>();
+
+  // deposit into root grid, weighted by fraction of volume of root cell
+  MGRootLevel &r0 = root[0];
+  std::fill(r0.src.begin(), r0.src.end(), 0.0);
+  for (int m=0; m<nmb; ++m) {
+    auto &lloc = pm->lloc_eachmb[pmy_pack->gids + m];
+    int dl = lloc.level - pm->root_level;
+    Real wght = 1.0/static_cast<Real>(1 << (dim*dl));
+    r0.src[r0.Index((lloc.lx3 >> dl) + 1, (lloc.lx2 >> dl) + 1, (lloc.lx1 >> dl) + 1)] +=
+        wght*mb_val.h_view(m);
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, r0.src.data(), static_cast<int>(r0.src.size()),
+                MPI_ATHENA_REAL, MPI_SUM, mg_comm);
+#endif
+
+  // solve root grid using FMG followed by V-cycles
+  int ntot = r0.n1*r0.n2*r0.n3;
+  if (singular) {
+    Real mean = 0.0;
+    for (auto s : r0.src) {mean += s;}
+    mean /= static_cast<Real>(ntot);
+    for (int k=1; k<=r0.n3; ++k) {
+      for (int j=1; j<=r0.n2; ++j) {
+        for (int i=1; i<=r0.n1; ++i) {r0.src[r0.Index(k,j,i)] -= mean;}
+      }
+    }
+  }
+  int nroot = static_cast<int>(root.size());
+  for (int l=0; l<nroot-1; ++l) {
+    RootRestrict(root[l], root[l].src, root[l+1]);
+  }
+  std::fill(root[nroot-1].u.begin(), root[nroot-1].u.end(), 0.0);
+  RootVCycle(nroot-1);
+  for (int l=nroot-2; l>=0; --l) {
+    RootProlongate(root[l+1], root[l], false);
+    RootVCycle(l);
+  }
+  Real rnorm = RootNorm(r0, r0.src);
+  RootDefect(r0);
+  for (int n=0; n<max_iterations; ++n) {
+    if (RootNorm(r0, r0.def) <= threshold*rnorm) break;
+    RootVCycle(0);
+    RootDefect(r0);
+  }
+  if (singular) {
+    Real mean = 0.0;
+    for (int k=1; k<=r0.n3; ++k) {
+      for (int j=1; j<=r0.n2; ++j) {
+        for (int i=1; i<=r0.n1; ++i) {mean += r0.u[r0.Index(k,j,i)];}
+      }
+    }
+    mean /= static_cast<Real>(ntot);
+    for (auto &u0 : r0.u) {u0 -= mean;}
+  }
+  RootBoundary(r0, r0.u);
+
+  // interpolate solution to center of each MeshBlock, and add to u on device
+  for (int m=0; m<nmb; ++m) {
+    auto &lloc = pm->lloc_eachmb[pmy_pack->gids + m];
+    int dl = lloc.level - pm->root_level;
+    Real scale = static_cast<Real>(1 << dl);
+    int i = (lloc.lx1 >> dl) + 1, j = (lloc.lx2 >> dl) + 1, k = (lloc.lx3 >> dl) + 1;
+    // offsets of MeshBlock center from root cell center in units of root cell size
+    Real x1 = (static_cast<Real>(lloc.lx1) + 0.5)/scale - static_cast<Real>(i) + 0.5;
+    Real x2 = (static_cast<Real>(lloc.lx2) + 0.5)/scale - static_cast<Real>(j) + 0.5;
+    Real x3 = (static_cast<Real>(lloc.lx3) + 0.5)/scale - static_cast<Real>(k) + 0.5;
+    Real v = r0.u[r0.Index(k,j,i)];
+    if (dl > 0) {
+      v += 0.5*x1*(r0.u[r0.Index(k,j,i+1)] - r0.u[r0.Index(k,j,i-1)]);
+      if (pm->multi_d) {
+        v += 0.5*x2*(r0.u[r0.Index(k,j+1,i)] - r0.u[r0.Index(k,j-1,i)]);
+      }
+      if (pm->three_d) {
+        v += 0.5*x3*(r0.u[r0.Index(k+1,j,i)] - r0.u[r0.Index(k-1,j,i)]);
+      }
+    }
+    mb_val.h_view(m) = v;
+  }
+  mb_val.template modify<HostMemSpace>();
+  mb_val.template sync<DevExeSpace>();
+  auto u_ = u[nlevels-1];
+  par_for("mg_scatter", DevExeSpace(), 0, nmb-1,
+  KOKKOS_LAMBDA(int m) {
+    u_(m,0,ks,js,1) += val.d_view(m);
+  });
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::RootVCycle()
+//! \brief V-cycle on the root grid starting from level l0.  The coarsest level of the
+//! root grid (which may have an odd number of cells) is solved by many RBGS sweeps.
+
+void Multigrid::RootVCycle(int l0) {
+  int lc = static_cast<int>(root.size()) - 1;
+  for (int l=l0; l<lc; ++l) {
+    if (l > l0) {std::fill(root[l].u.begin(), root[l].u.end(), 0.0);}
+    RootSmooth(root[l], npresmooth);
+    RootDefect(root[l]);
+    RootRestrict(root[l], root[l].def, root[l+1]);
+  }
+  MGRootLevel &rc = root[lc];
+  if (lc > l0) {std::fill(rc.u.begin(), rc.u.end(), 0.0);}
+  int nmax = std::max(rc.n1, std::max(rc.n2, rc.n3));
+  RootSmooth(rc, 4*nmax*nmax + 16);
+  for (int l=lc-1; l>=l0; --l) {
+    RootProlongate(root[l+1], root[l], true);
+    RootSmooth(root[l], npostsmooth);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::RootBoundary()
+//! \brief sets ghost cells of array on root grid level, using periodic or u=0 BCs
+
+void Multigrid::RootBoundary(MGRootLevel &r, std::vector<Real> &a) {
+  Mesh *pm = pmy_pack->pmesh;
+  for (int k=1; k<=r.n3; ++k) {
+    for (int j=1; j<=r.n2; ++j) {
+      if (periodic[0]) {
+        a[r.Index(k,j,0)] = a[r.Index(k,j,r.n1)];
+        a[r.Index(k,j,r.n1+1)] = a[r.Index(k,j,1)];
+      } else {
+        a[r.Index(k,j,0)] = -a[r.Index(k,j,1)];
+        a[r.Index(k,j,r.n1+1)] = -a[r.Index(k,j,r.n1)];
+      }
+    }
+  }
+  if (pm->multi_d) {
+    for (int k=1; k<=r.n3; ++k) {
+      for (int i=1; i<=r.n1; ++i) {
+        if (periodic[1]) {
+          a[r.Index(k,0,i)] = a[r.Index(k,r.n2,i)];
+          a[r.Index(k,r.n2+1,i)] = a[r.Index(k,1,i)];
+        } else {
+          a[r.Index(k,0,i)] = -a[r.Index(k,1,i)];
+          a[r.Index(k,r.n2+1,i)] = -a[r.Index(k,r.n2,i)];
+        }
+      }
+    }
+  }
+  if (pm->three_d) {
+    for (int j=1; j<=r.n2; ++j) {
+      for (int i=1; i<=r.n1; ++i) {
+        if (periodic[2]) {
+          a[r.Index(0,j,i)] = a[r.Index(r.n3,j,i)];
+          a[r.Index(r.n3+1,j,i)] = a[r.Index(1,j,i)];
+        } else {
+          a[r.Index(0,j,i)] = -a[r.Index(1,j,i)];
+          a[r.Index(r.n3+1,j,i)] = -a[r.Index(r.n3,j,i)];
+        }
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::RootSmooth()
+//! \brief nsweep red-black Gauss-Seidel sweeps on root grid level
+
+void Multigrid::RootSmooth(MGRootLevel &r, int nsweep) {
+  Mesh *pm = pmy_pack->pmesh;
+  Real idx1 = 1.0/SQR(r.h1);
+  Real idx2 = (pm->multi_d)? 1.0/SQR(r.h2) : 0.0;
+  Real idx3 = (pm->three_d)? 1.0/SQR(r.h3) : 0.0;
+  Real diag = 2.0*(idx1 + idx2 + idx3);
+  for (int s=0; s<nsweep; ++s) {
+    for (int color=0; color<2; ++color) {
+      RootBoundary(r, r.u);
+      for (int k=1; k<=r.n3; ++k) {
+        for (int j=1; j<=r.n2; ++j) {
+          for (int i=1+((color+j+k)&1); i<=r.n1; i+=2) {
+            Real off = (r.u[r.Index(k,j,i+1)] + r.u[r.Index(k,j,i-1)])*idx1;
+            if (pm->multi_d) {
+              off += (r.u[r.Index(k,j+1,i)] + r.u[r.Index(k,j-1,i)])*idx2;
+            }
+            if (pm->three_d) {
+              off += (r.u[r.Index(k+1,j,i)] + r.u[r.Index(k-1,j,i)])*idx3;
+            }
+            r.u[r.Index(k,j,i)] = (off - r.src[r.Index(k,j,i)])/diag;
+          }
+        }
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::RootDefect()
+//! \brief def = src - Lap(u) on root grid level
+
+void Multigrid::RootDefect(MGRootLevel &r) {
+  Mesh *pm = pmy_pack->pmesh;
+  RootBoundary(r, r.u);
+  Real idx1 = 1.0/SQR(r.h1);
+  Real idx2 = 1.0/SQR(r.h2);
+  Real idx3 = 1.0/SQR(r.h3);
+  for (int k=1; k<=r.n3; ++k) {
+    for (int j=1; j<=r.n2; ++j) {
+      for (int i=1; i<=r.n1; ++i) {
+        Real uc = r.u[r.Index(k,j,i)];
+        Real lap = (r.u[r.Index(k,j,i+1)] - 2.0*uc + r.u[r.Index(k,j,i-1)])*idx1;
+        if (pm->multi_d) {
+          lap += (r.u[r.Index(k,j+1,i)] - 2.0*uc + r.u[r.Index(k,j-1,i)])*idx2;
+        }
+        if (pm->three_d) {
+          lap += (r.u[r.Index(k+1,j,i)] - 2.0*uc + r.u[r.Index(k-1,j,i)])*idx3;
+        }
+        r.def[r.Index(k,j,i)] = r.src[r.Index(k,j,i)] - lap;
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::RootRestrict()
+//! \brief restricts array 'a' on root grid level f into source on next coarser level c
+
+void Multigrid::RootRestrict(MGRootLevel &f, std::vector<Real> &a, MGRootLevel &c) {
+  Mesh *pm = pmy_pack->pmesh;
+  int nj = (pm->multi_d)? 2 : 1;
+  int nk = (pm->three_d)? 2 : 1;
+  Real wght = 1.0/static_cast<Real>(2*nj*nk);
+  for (int k=1; k<=c.n3; ++k) {
+    for (int j=1; j<=c.n2; ++j) {
+      for (int i=1; i<=c.n1; ++i) {
+        Real sum = 0.0;
+        for (int fk=nk*(k-1)+1; fk<=nk*k; ++fk) {
+          for (int fj=nj*(j-1)+1; fj<=nj*j; ++fj) {
+            sum += a[f.Index(fk,fj,2*i-1)] + a[f.Index(fk,fj,2*i)];
+          }
+        }
+        c.src[c.Index(k,j,i)] = wght*sum;
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Multigrid::RootProlongate()
+//! \brief linear prolongation of u on root grid level c to level f, same as the
+//! prolongation on block levels in Multigrid::Prolongate()
+
+void Multigrid::RootProlongate(MGRootLevel &c, MGRootLevel &f, bool add) {
+  Mesh *pm = pmy_pack->pmesh;
+  RootBoundary(c, c.u);
+  for (int k=1; k<=f.n3; ++k) {
+    int ck = (pm->three_d)? (k + 1)/2 : 1;
+    Real sk = (k & 1)? -0.125 : 0.125;
+    for (int j=1; j<=f.n2; ++j) {
+      int cj = (pm->multi_d)? (j + 1)/2 : 1;
+      Real sj = (j & 1)? -0.125 : 0.125;
+      for (int i=1; i<=f.n1; ++i) {
+        int ci = (i + 1)/2;
+        Real si = (i & 1)? -0.125 : 0.125;
+        Real v = c.u[c.Index(ck,cj,ci)];
+        v += si*(c.u[c.Index(ck,cj,ci+1)] - c.u[c.Index(ck,cj,ci-1)]);
+        if (pm->multi_d) {
+          v += sj*(c.u[c.Index(ck,cj+1,ci)] - c.u[c.Index(ck,cj-1,ci)]);
+        }
+        if (pm->three_d) {
+          v += sk*(c.u[c.Index(ck+1,cj,ci)] - c.u[c.Index(ck-1,cj,ci)]);
+        }
+        if (add) {
+          f.u[f.Index(k,j,i)] += v;
+        } else {
+          f.u[f.Index(k,j,i)] = v;
+        }
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real Multigrid::RootNorm()
+//! \brief RMS of array over root grid level
+
+Real Multigrid::RootNorm(MGRootLevel &r, std::vector<Real> &a) {
+  Real sum = 0.0;
+  for (int k=1; k<=r.n3; ++k) {
+    for (int j=1; j<=r.n2; ++j) {
+      for (int i=1; i<=r.n1; ++i) {sum += SQR(a[r.Index(k,j,i)]);}
+    }
+  }
+  return std::sqrt(sum/static_cast<Real>(r.n1*r.n2*r.n3));
+}
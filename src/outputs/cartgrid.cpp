@@ -8,9 +8,12 @@
 
 #include <sys/stat.h>  // mkdir
 
+#include <cmath>
 #include <cstdio> // snprintf
 #include <fstream>
 #include <string>
+#include <utility>
+#include <vector>
 #include <sstream>
 
 #include "athena.hpp"
@@ -19,6 +22,7 @@
 #include "outputs.hpp"
 #include "parameter_input.hpp"
 #include "utils/cart_grid.hpp"
+#include "utils/point_interpolator.hpp"
 
 CartesianGridOutput::CartesianGridOutput(ParameterInput *pin, Mesh *pm,
                                          OutputParameters op)
@@ -48,17 +52,38 @@ CartesianGridOutput::CartesianGridOutput(ParameterInput *pin, Mesh *pm,
     md.numpoints[d] = numpoints[d];
   }
   md.is_cheb = is_cheb;
+
+  // interpolation weights for points on grid are computed once, and only reset if
+  // mesh changes with AMR.  Points are ordered as in outarray(n,0,i,j,k).
+  int npts = numpoints[0] * numpoints[1] * numpoints[2];
+  pinterp = new PointInterpolator(pm->pmb_pack, npts);
+  for (int i = 0; i < numpoints[0]; ++i) {
+    for (int j = 0; j < numpoints[1]; ++j) {
+      for (int k = 0; k < numpoints[2]; ++k) {
+        int p = (i * numpoints[1] + j) * numpoints[2] + k;
+        Real x1 = pcart->min_x1 + i * pcart->d_x1;
+        Real x2 = pcart->min_x2 + j * pcart->d_x2;
+        Real x3 = pcart->min_x3 + k * pcart->d_x3;
+        if (is_cheb) {
+          x1 = center[0] + extent[0] * std::cos(i * M_PI / (numpoints[0] - 1));
+          x2 = center[1] + extent[1] * std::cos(j * M_PI / (numpoints[1] - 1));
+          x3 = center[2] + extent[2] * std::cos(k * M_PI / (numpoints[2] - 1));
+        }
+        pinterp->pos(p, 0) = x1;
+        pinterp->pos(p, 1) = x2;
+        pinterp->pos(p, 2) = x3;
+      }
+    }
+  }
+  pinterp->SetIndicesAndWeights();
 }
 
-CartesianGridOutput::~CartesianGridOutput() { delete pcart; }
+CartesianGridOutput::~CartesianGridOutput() {
+  delete pcart;
+  delete pinterp;
+}
 
 void CartesianGridOutput::LoadOutputData(Mesh *pm) {
-  // If AMR is enabled we need to reset the CartesianGrid
-  if (pm->adaptive) {
-    pcart->SetInterpolationIndices();
-    pcart->SetInterpolationWeights();
-  }
-
   int nout_vars = outvars.size();
   Kokkos::realloc(outarray, nout_vars, 1, md.numpoints[0], md.numpoints[1],
                   md.numpoints[2]);
@@ -68,24 +93,14 @@ void CartesianGridOutput::LoadOutputData(Mesh *pm) {
     ComputeDerivedVariable(out_params.variable, pm);
   }
 
+  // Interpolate all variables to points on grid owned by this rank, then collect
+  // values from all ranks in outarray on root
+  std::vector<std::pair<DvceArray5D<Real>*, int>> vars;
   for (int n = 0; n < nout_vars; ++n) {
-    pcart->InterpolateToGrid(outvars[n].data_index, *(outvars[n].data_ptr));
-    auto v_slice =
-        Kokkos::subview(outarray, n, 0, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
-    Kokkos::deep_copy(v_slice, pcart->interp_vals.h_view);
-  }
-#if MPI_PARALLEL_ENABLED
-  // Note that InterpolateToGrid will set zero values for points not owned by
-  // current rank
-  int count = nout_vars * md.numpoints[0] * md.numpoints[1] * md.numpoints[2];
-  if (0 == global_variable::my_rank) {
-    MPI_Reduce(MPI_IN_PLACE, outarray.data(), count, MPI_ATHENA_REAL, MPI_SUM,
-               0, MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(outarray.data(), outarray.data(), count, MPI_ATHENA_REAL,
-               MPI_SUM, 0, MPI_COMM_WORLD);
+    vars.push_back(std::make_pair(outvars[n].data_ptr, outvars[n].data_index));
   }
-#endif
+  pinterp->Interpolate(vars);
+  pinterp->GatherToRoot(outarray.data());
 }
 
 void CartesianGridOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
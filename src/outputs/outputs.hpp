@@ -389,6 +389,7 @@ class RestartOutput : public BaseTypeOutput {
 
 // Forward declaration
 class CartesianGrid;
+class PointInterpolator;
 
 //----------------------------------------------------------------------------------------
 //! \class CartesianGridOutput
@@ -412,6 +413,7 @@ class CartesianGridOutput : public BaseTypeOutput {
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
  private:
   CartesianGrid *pcart;
+  PointInterpolator *pinterp;
   MetaData md;
 };
 
@@ -431,6 +433,7 @@ class SphericalSurfaceOutput : public BaseTypeOutput {
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
  private:
   SphericalSurface *psurf;
+  PointInterpolator *pinterp;
 };
 //----------------------------------------------------------------------------------------
 //! \class EventLogOutput
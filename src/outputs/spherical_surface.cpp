@@ -14,12 +14,15 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
 #include "mesh/mesh.hpp"
 #include "parameter_input.hpp"
 #include "outputs.hpp"
+#include "utils/point_interpolator.hpp"
 
 
 SphericalSurfaceOutput::SphericalSurfaceOutput(ParameterInput *pin, Mesh *pm,
@@ -33,17 +36,24 @@ SphericalSurfaceOutput::SphericalSurfaceOutput(ParameterInput *pin, Mesh *pm,
   Real yc = pin->GetOrAddReal(op.block_name, "yc", 0.0);
   Real zc = pin->GetOrAddReal(op.block_name, "zc", 0.0);
   psurf = new SphericalSurface(pm->pmb_pack, ntheta, rad, xc, yc, zc);
+
+  // interpolation weights for points on surface are computed once, and only reset if
+  // mesh changes with AMR
+  pinterp = new PointInterpolator(pm->pmb_pack, psurf->nangles);
+  for (int n = 0; n < psurf->nangles; ++n) {
+    for (int d = 0; d < 3; ++d) {
+      pinterp->pos(n, d) = psurf->cart_pos.h_view(n, d);
+    }
+  }
+  pinterp->SetIndicesAndWeights();
 }
 
-SphericalSurfaceOutput::~SphericalSurfaceOutput() { delete psurf; }
+SphericalSurfaceOutput::~SphericalSurfaceOutput() {
+  delete psurf;
+  delete pinterp;
+}
 
 void SphericalSurfaceOutput::LoadOutputData(Mesh *pm) {
-  // If AMR is enabled we need to reset the CartesianGrid
-  if (pm->adaptive) {
-    psurf->SetInterpolationIndices();
-    psurf->SetInterpolationWeights();
-  }
-
   int nout_vars = outvars.size();
   Kokkos::realloc(outarray, nout_vars, 1, 1, 1, psurf->nangles);
 
@@ -52,23 +62,14 @@ void SphericalSurfaceOutput::LoadOutputData(Mesh *pm) {
     ComputeDerivedVariable(out_params.variable, pm);
   }
 
+  // Interpolate all variables to points on surface owned by this rank, then collect
+  // values from all ranks in outarray on root
+  std::vector<std::pair<DvceArray5D<Real>*, int>> vars;
   for (int n = 0; n < nout_vars; ++n) {
-    psurf->InterpolateToSphere(outvars[n].data_index, *(outvars[n].data_ptr));
-    auto v_slice = Kokkos::subview(outarray, n, 0, 0, 0, Kokkos::ALL);
-    Kokkos::deep_copy(v_slice, psurf->interp_vals.h_view);
+    vars.push_back(std::make_pair(outvars[n].data_ptr, outvars[n].data_index));
   }
-#if MPI_PARALLEL_ENABLED
-  // Note that InterpolateToSphere will set zero values for points not owned by
-  // current rank
-  int count = nout_vars * psurf->nangles;
-  if (0 == global_variable::my_rank) {
-    MPI_Reduce(MPI_IN_PLACE, outarray.data(), count, MPI_ATHENA_REAL, MPI_SUM,
-               0, MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(outarray.data(), outarray.data(), count, MPI_ATHENA_REAL,
-               MPI_SUM, 0, MPI_COMM_WORLD);
-  }
-#endif
+  pinterp->Interpolate(vars);
+  pinterp->GatherToRoot(outarray.data());
 }
 
 void SphericalSurfaceOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
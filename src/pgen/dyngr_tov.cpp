@@ -13,6 +13,7 @@
 #include <limits>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -29,6 +30,7 @@
 #include "utils/tov/tov_polytrope.hpp"
 #include "utils/tov/tov_tabulated.hpp"
 #include "utils/tov/tov_piecewise_poly.hpp"
+#include "utils/id_cache.hpp"
 
 #include <Kokkos_Random.hpp>
 
@@ -121,110 +123,118 @@ void SetupTOV(ParameterInput *pin, Mesh* pmy_mesh_) {
   auto &adm = pmbp->padm->adm;
   auto &tov_ = my_tov;
   auto &eos_ = eos;
-  Kokkos::Random_XorShift64_Pool<> rand_pool64(pmbp->gids);
-  par_for("pgen_tov1", DevExeSpace(), 0, nmb1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-    // Calculate the rest-mass density, pressure, and mass for a specific isotropic
-    // radial coordinate.
-    Real r = sqrt(SQR(x1v) + SQR(x2v) + SQR(x3v));
-    Real s = sqrt(SQR(x1v) + SQR(x2v));
-    Real rho, p, mass, alp, r_schw;
-    Real vr = 0.;
-    Real p_pert = 0.;
-    Real ye = ye_atmo;
-    auto &use_ye_ = use_ye;
-    if (!isotropic) {
-      tov_.GetPrimitivesAtPoint(eos_, r, rho, p, mass, alp);
-      if (r <= tov_.R_edge) {
-        Real x = r/tov_.R_edge;
-        vr = 0.5*v_pert*(3.0*x - x*x*x);
-        auto rand_gen = rand_pool64.get_state();
-        p_pert = 2.0*p_pert*(rand_gen.frand() - 0.5);
-        rand_pool64.free_state(rand_gen);
-        if constexpr (use_ye) {
-          ye = eos_.template GetYeFromRho<tov::LocationTag::Device>(rho);
+  // Primitives and ADM variables are read from the initial data cache if it is enabled
+  // (<problem>/id_cache_dir) and contains a snapshot for this star and mesh.
+  InitialDataCache id_cache(pin, pmy_mesh_, "", {"mhd"});
+  std::vector<DvceArray5D<Real>> id_vars = {w0_, pmbp->padm->u_adm};
+  std::vector<Real> id_scalars;
+  if (!id_cache.Load(id_vars, id_scalars)) {
+    Kokkos::Random_XorShift64_Pool<> rand_pool64(pmbp->gids);
+    par_for("pgen_tov1", DevExeSpace(), 0, nmb1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+      // Calculate the rest-mass density, pressure, and mass for a specific isotropic
+      // radial coordinate.
+      Real r = sqrt(SQR(x1v) + SQR(x2v) + SQR(x3v));
+      Real s = sqrt(SQR(x1v) + SQR(x2v));
+      Real rho, p, mass, alp, r_schw;
+      Real vr = 0.;
+      Real p_pert = 0.;
+      Real ye = ye_atmo;
+      auto &use_ye_ = use_ye;
+      if (!isotropic) {
+        tov_.GetPrimitivesAtPoint(eos_, r, rho, p, mass, alp);
+        if (r <= tov_.R_edge) {
+          Real x = r/tov_.R_edge;
+          vr = 0.5*v_pert*(3.0*x - x*x*x);
+          auto rand_gen = rand_pool64.get_state();
+          p_pert = 2.0*p_pert*(rand_gen.frand() - 0.5);
+          rand_pool64.free_state(rand_gen);
+          if constexpr (use_ye) {
+            ye = eos_.template GetYeFromRho<tov::LocationTag::Device>(rho);
+          }
         }
-      }
-    } else {
-      tov_.GetPrimitivesAtIsoPoint(eos_, r, rho, p, mass, alp);
-      r_schw = tov_.FindSchwarzschildR(r, mass);
-      if (r_schw <= tov_.R_edge) {
-        Real x = r_schw/tov_.R_edge;
-        vr = 0.5*v_pert*(3.0*x - x*x*x);
-        auto rand_gen = rand_pool64.get_state();
-        p_pert = 2.0*p_pert*(rand_gen.frand() - 0.5);
-        rand_pool64.free_state(rand_gen);
-        if constexpr (use_ye) {
-          ye = eos_.template GetYeFromRho<tov::LocationTag::Device>(rho);
+      } else {
+        tov_.GetPrimitivesAtIsoPoint(eos_, r, rho, p, mass, alp);
+        r_schw = tov_.FindSchwarzschildR(r, mass);
+        if (r_schw <= tov_.R_edge) {
+          Real x = r_schw/tov_.R_edge;
+          vr = 0.5*v_pert*(3.0*x - x*x*x);
+          auto rand_gen = rand_pool64.get_state();
+          p_pert = 2.0*p_pert*(rand_gen.frand() - 0.5);
+          rand_pool64.free_state(rand_gen);
+          if constexpr (use_ye) {
+            ye = eos_.template GetYeFromRho<tov::LocationTag::Device>(rho);
+          }
         }
       }
-    }
-
-    // Set hydrodynamic quantities
-    //w0_(m,IDN,k,j,i) = fmax(rho, tov_.dfloor);
-    //w0_(m,IPR,k,j,i) = fmax(p*(1. + p_pert), tov_.pfloor);
-    w0_(m,IDN,k,j,i) = rho;
-    w0_(m,IPR,k,j,i) = p*(1. + p_pert);
-    w0_(m,IVX,k,j,i) = vr*x1v/r;
-    w0_(m,IVY,k,j,i) = vr*x2v/r;
-    w0_(m,IVZ,k,j,i) = vr*x3v/r;
-    auto &nvars = nvars_;
-    auto &nscal = nscal_;
-    if (use_ye && nscal >= 1) {
-      w0_(m,nvars,k,j,i) = ye;
-    }
 
-    // Set ADM variables
-    adm.alpha(m,k,j,i) = alp;
-    if (minkowski) {
-      adm.g_dd(m,0,0,k,j,i) = adm.g_dd(m,1,1,k,j,i) = adm.g_dd(m,2,2,k,j,i) = 1.0;
-      adm.g_dd(m,0,1,k,j,i) = adm.g_dd(m,0,2,k,j,i) = adm.g_dd(m,1,2,k,j,i) = 0.0;
-      adm.alpha(m,k,j,i) = 1.0;
-    } else if (!isotropic) {
-      // Auxiliary metric quantities
-      Real fmet = 0.0;
-      if (r > 0) {
-        fmet = (1./(1. - 2*mass/r) - 1.)/(r*r);
+      // Set hydrodynamic quantities
+      //w0_(m,IDN,k,j,i) = fmax(rho, tov_.dfloor);
+      //w0_(m,IPR,k,j,i) = fmax(p*(1. + p_pert), tov_.pfloor);
+      w0_(m,IDN,k,j,i) = rho;
+      w0_(m,IPR,k,j,i) = p*(1. + p_pert);
+      w0_(m,IVX,k,j,i) = vr*x1v/r;
+      w0_(m,IVY,k,j,i) = vr*x2v/r;
+      w0_(m,IVZ,k,j,i) = vr*x3v/r;
+      auto &nvars = nvars_;
+      auto &nscal = nscal_;
+      if (use_ye && nscal >= 1) {
+        w0_(m,nvars,k,j,i) = ye;
       }
 
-      adm.g_dd(m,0,0,k,j,i) = x1v*x1v*fmet + 1.0;
-      adm.g_dd(m,0,1,k,j,i) = x1v*x2v*fmet;
-      adm.g_dd(m,0,2,k,j,i) = x1v*x3v*fmet;
-      adm.g_dd(m,1,1,k,j,i) = x2v*x2v*fmet + 1.0;
-      adm.g_dd(m,1,2,k,j,i) = x2v*x3v*fmet;
-      adm.g_dd(m,2,2,k,j,i) = x3v*x3v*fmet + 1.0;
-      Real det = adm::SpatialDet(
-              adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i),
-              adm.g_dd(m,0,2,k,j,i), adm.g_dd(m,1,1,k,j,i),
-              adm.g_dd(m,1,2,k,j,i), adm.g_dd(m,2,2,k,j,i));
-      adm.psi4(m,k,j,i) = pow(det, 1./3.);
-    } else {
-      Real fmet = 1.;
-      if (r > 0) {
-        fmet = r_schw/r;
-      }
-      Real psi4 = fmet*fmet;
+      // Set ADM variables
+      adm.alpha(m,k,j,i) = alp;
+      if (minkowski) {
+        adm.g_dd(m,0,0,k,j,i) = adm.g_dd(m,1,1,k,j,i) = adm.g_dd(m,2,2,k,j,i) = 1.0;
+        adm.g_dd(m,0,1,k,j,i) = adm.g_dd(m,0,2,k,j,i) = adm.g_dd(m,1,2,k,j,i) = 0.0;
+        adm.alpha(m,k,j,i) = 1.0;
+      } else if (!isotropic) {
+        // Auxiliary metric quantities
+        Real fmet = 0.0;
+        if (r > 0) {
+          fmet = (1./(1. - 2*mass/r) - 1.)/(r*r);
+        }
 
-      adm.g_dd(m,0,0,k,j,i) = adm.g_dd(m,1,1,k,j,i) = adm.g_dd(m,2,2,k,j,i) = psi4;
-      adm.g_dd(m,0,1,k,j,i) = adm.g_dd(m,0,2,k,j,i) = adm.g_dd(m,1,2,k,j,i) = 0.0;
-      adm.psi4(m,k,j,i) = psi4;
-    }
-    adm.beta_u(m,0,k,j,i) = adm.beta_u(m,1,k,j,i) = adm.beta_u(m,2,k,j,i) = 0.0;
-    adm.vK_dd(m,0,0,k,j,i) = adm.vK_dd(m,0,1,k,j,i) = adm.vK_dd(m,0,2,k,j,i) = 0.0;
-    adm.vK_dd(m,1,1,k,j,i) = adm.vK_dd(m,1,2,k,j,i) = adm.vK_dd(m,2,2,k,j,i) = 0.0;
-  });
+        adm.g_dd(m,0,0,k,j,i) = x1v*x1v*fmet + 1.0;
+        adm.g_dd(m,0,1,k,j,i) = x1v*x2v*fmet;
+        adm.g_dd(m,0,2,k,j,i) = x1v*x3v*fmet;
+        adm.g_dd(m,1,1,k,j,i) = x2v*x2v*fmet + 1.0;
+        adm.g_dd(m,1,2,k,j,i) = x2v*x3v*fmet;
+        adm.g_dd(m,2,2,k,j,i) = x3v*x3v*fmet + 1.0;
+        Real det = adm::SpatialDet(
+                adm.g_dd(m,0,0,k,j,i), adm.g_dd(m,0,1,k,j,i),
+                adm.g_dd(m,0,2,k,j,i), adm.g_dd(m,1,1,k,j,i),
+                adm.g_dd(m,1,2,k,j,i), adm.g_dd(m,2,2,k,j,i));
+        adm.psi4(m,k,j,i) = pow(det, 1./3.);
+      } else {
+        Real fmet = 1.;
+        if (r > 0) {
+          fmet = r_schw/r;
+        }
+        Real psi4 = fmet*fmet;
+
+        adm.g_dd(m,0,0,k,j,i) = adm.g_dd(m,1,1,k,j,i) = adm.g_dd(m,2,2,k,j,i) = psi4;
+        adm.g_dd(m,0,1,k,j,i) = adm.g_dd(m,0,2,k,j,i) = adm.g_dd(m,1,2,k,j,i) = 0.0;
+        adm.psi4(m,k,j,i) = psi4;
+      }
+      adm.beta_u(m,0,k,j,i) = adm.beta_u(m,1,k,j,i) = adm.beta_u(m,2,k,j,i) = 0.0;
+      adm.vK_dd(m,0,0,k,j,i) = adm.vK_dd(m,0,1,k,j,i) = adm.vK_dd(m,0,2,k,j,i) = 0.0;
+      adm.vK_dd(m,1,1,k,j,i) = adm.vK_dd(m,1,2,k,j,i) = adm.vK_dd(m,2,2,k,j,i) = 0.0;
+    });
+    id_cache.Save(id_vars, id_scalars);
+  }
 
   // parse some parameters
   Real b_norm = pin->GetOrAddReal("problem", "b_norm", 0.0);
@@ -14,6 +14,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/adm.hpp"
@@ -34,6 +35,7 @@
 #include "utils/tov/tov_polytrope.hpp"
 #include "utils/tov/tov_piecewise_poly.hpp"
 #include "utils/tov/tov_tabulated.hpp"
+#include "utils/id_cache.hpp"
 
 void EllipticaBinaryHistory(HistoryData *pdata, Mesh *pm);
 void EllipticaBinaryRefinementCondition(MeshBlockPack *pmbp);
@@ -45,26 +47,19 @@ KOKKOS_INLINE_FUNCTION
 static Real A2(Real x, Real y, Real z, Real I_0, Real r_0);
 
 //----------------------------------------------------------------------------------------
-//! \fn SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_)
-//! \brief Setup of the BHNS/BNS binary with Elliptica
+//! \fn ImportBinary(ParameterInput *pin, Mesh* pmy_mesh_, std::vector<Real> &params)
+//! \brief Interpolates Elliptica solution to all cells (including ghost zones) in the
+//! pack, and stores metric and primitives in u_adm, w0 and (gauge) z4c u0 on the device.
+//! Type of binary, separation and positions of compact objects are returned in params,
+//! in the order listed in SetupBinary().
 template<class TOVEOS>
-void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
+void ImportBinary(ParameterInput *pin, Mesh* pmy_mesh_, std::vector<Real> &params) {
   MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
   auto &indcs         = pmy_mesh_->mb_indcs;
   auto &size          = pmbp->pmb->mb_size;
   int &is             = indcs.is;
-  int &ie             = indcs.ie;
   int &js             = indcs.js;
-  int &je             = indcs.je;
   int &ks             = indcs.ks;
-  int &ke             = indcs.ke;
-
-  if (pmbp->pdyngr == nullptr || pmbp->pz4c == nullptr) {
-    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
-              << std::endl
-              << "BNS data requires <mhd> and <z4c> blocks." << std::endl;
-    exit(EXIT_FAILURE);
-  }
 
   std::string fname = pin->GetString("problem", "initial_data_file");
   std::string tab_path =
@@ -86,12 +81,7 @@ void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
     "adm_Kxx,adm_Kxy,adm_Kxz,adm_Kyy,adm_Kyz,adm_Kzz,"
     "grhd_rho,grhd_p,grhd_epsl,grhd_vx,grhd_vy,grhd_vz";
 
-  // MHD parameters
-  Real gauss_cgs_to_geo = 8.3519664583273e+19;
   Real rho_cut = pin->GetOrAddReal("problem", "rho_cut", 1e-5);
-  Real b_max   = pin->GetOrAddReal("problem", "b_max", 1e12) / gauss_cgs_to_geo;
-  Real r_0     = pin->GetOrAddReal("problem", "r_0_current", 5.0);
-  Real I_0     = 4 * r_0 * b_max / (23.0 * M_PI);
 
   int ncells1 = indcs.nx1 + 2 * (indcs.ng);
   int ncells2 = indcs.nx2 + 2 * (indcs.ng);
@@ -115,39 +105,24 @@ void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
   }
 
   // Populate coordinates for Elliptica
-  // TODO(JMF): Replace with a Kokkos loop on
-  // Kokkos::DefaultHostExecutionSpace() to improve performance.
-  int idx = 0;
-  for (int m = 0; m < nmb; m++) {
-    Real &x1min = size.h_view(m).x1min;
-    Real &x1max = size.h_view(m).x1max;
-    int nx1     = indcs.nx1;
-
-    Real &x2min = size.h_view(m).x2min;
-    Real &x2max = size.h_view(m).x2max;
-    int nx2     = indcs.nx2;
-
-    Real &x3min = size.h_view(m).x3min;
-    Real &x3max = size.h_view(m).x3max;
-    int nx3     = indcs.nx3;
-
-    for (int k = 0; k < ncells3; k++) {
-      Real z = CellCenterX(k - ks, nx3, x3min, x3max);
-      for (int j = 0; j < ncells2; j++) {
-        Real y = CellCenterX(j - js, nx2, x2min, x2max);
-        for (int i = 0; i < ncells1; i++) {
-          Real x = CellCenterX(i - is, nx1, x1min, x1max);
-
-          x_coords[idx] = x;
-          y_coords[idx] = y;
-          z_coords[idx] = z;
-
-          // Increment flat index
-          idx++;
-        }
-      }
-    }
-  }
+  int ncells_per_mb = ncells3 * ncells2 * ncells1;
+  Kokkos::parallel_for("elliptica_coords",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, width),
+      [&](const int idx) {
+    int m   = idx / ncells_per_mb;
+    int rem = idx - m * ncells_per_mb;
+    int k   = rem / (ncells2 * ncells1);
+    rem    -= k * ncells2 * ncells1;
+    int j   = rem / ncells1;
+    int i   = rem % ncells1;
+
+    x_coords[idx] = CellCenterX(i - is, indcs.nx1, size.h_view(m).x1min,
+                                size.h_view(m).x1max);
+    y_coords[idx] = CellCenterX(j - js, indcs.nx2, size.h_view(m).x2min,
+                                size.h_view(m).x2max);
+    z_coords[idx] = CellCenterX(k - ks, indcs.nx3, size.h_view(m).x3min,
+                                size.h_view(m).x3max);
+  });
 
   idr->set_param("ADM_B1I_form", "zero", idr);
 
@@ -230,88 +205,88 @@ void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
     std::cout << "Label indices saved." << std::endl;
   }
 
-  // TODO(JMF): Replace with a Kokkos loop on
-  // Kokkos::DefaultHostExecutionSpace() to improve performance.
-  idx = 0;
-  for (int m = 0; m < nmb; m++) {
-    for (int k = 0; k < ncells3; k++) {
-      for (int j = 0; j < ncells2; j++) {
-        for (int i = 0; i < ncells1; i++) {
-          // Extract metric quantities
-          host_adm.alpha(m, k, j, i)     = idr->field[i_alpha][idx];
-          host_adm.beta_u(m, 0, k, j, i) = idr->field[i_betax][idx];
-          host_adm.beta_u(m, 1, k, j, i) = idr->field[i_betay][idx];
-          host_adm.beta_u(m, 2, k, j, i) = idr->field[i_betaz][idx];
-
-          Real g3d[NSPMETRIC];
-          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = idr->field[i_gxx][idx];
-          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = idr->field[i_gxy][idx];
-          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = idr->field[i_gxz][idx];
-          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = idr->field[i_gyy][idx];
-          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = idr->field[i_gyz][idx];
-          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = idr->field[i_gzz][idx];
-
-          host_adm.vK_dd(m, 0, 0, k, j, i) = idr->field[i_Kxx][idx];
-          host_adm.vK_dd(m, 0, 1, k, j, i) = idr->field[i_Kxy][idx];
-          host_adm.vK_dd(m, 0, 2, k, j, i) = idr->field[i_Kxz][idx];
-          host_adm.vK_dd(m, 1, 1, k, j, i) = idr->field[i_Kyy][idx];
-          host_adm.vK_dd(m, 1, 2, k, j, i) = idr->field[i_Kyz][idx];
-          host_adm.vK_dd(m, 2, 2, k, j, i) = idr->field[i_Kzz][idx];
-
-          // Extract hydro quantities
-          // Note that Elliptica does not necessarily use the same baryon rest-mass as
-          // AthenaK. The most reasonable thing to do, then, is to extract the total
-          // energy density, which is invariant, and use that with the 1D EOS.
-          Real egas = idr->field[i_rho][idx] * (1.0 + idr->field[i_eps][idx]);
-          Real &rho = host_w0(m, IDN, k, j, i);
-          rho = eos.template GetRhoFromE<tov::LocationTag::Host>(egas);
-          Real vu[3] = {idr->field[i_vx][idx],
-                        idr->field[i_vy][idx],
-                        idr->field[i_vz][idx]};
-
-          // Check for garbage values thrown in by Elliptica.
-          if (rho <= rho_cut || !Kokkos::isfinite(rho)) {
-            rho = 0.0;
-            host_w0(m, IPR, k, j, i) = 0.0;
-            vu[0] = 0.0;
-            vu[1] = 0.0;
-            vu[2] = 0.0;
-          }
-
-          host_w0(m, IPR, k, j, i) = eos.template
-                                      GetPFromRho<tov::LocationTag::Host>(rho);
-
-          // If the electron fraction is available, find it in the 1D EOS.
-          if constexpr (use_ye) {
-            host_w0(m, IYF, k, j, i) = eos.template
-                                       GetYeFromRho<tov::LocationTag::Host>(rho);
-          }
-
-          // Before we store the velocity, we need to make sure it's physical
-          // and calculate the Lorentz factor. If the velocity is superluminal,
-          // we make a last-ditch attempt to salvage the solution by rescaling
-          // it to vsq = 1.0 - 1e-15
-          Real vsq = Primitive::SquareVector(vu, g3d);
-          if (1.0 - vsq <= 0) {
-            std::cout << "The velocity is superluminal!" << std::endl
-                      << "Attempting to adjust..." << std::endl;
-            Real fac = sqrt((1.0 - 1e-15) / vsq);
-            vu[0] *= fac;
-            vu[1] *= fac;
-            vu[2] *= fac;
-            vsq = 1.0 - 1.0e-15;
-          }
-          Real W = sqrt(1.0 / (1.0 - vsq));
-
-          host_w0(m, IVX, k, j, i) = W * vu[0];
-          host_w0(m, IVY, k, j, i) = W * vu[1];
-          host_w0(m, IVZ, k, j, i) = W * vu[2];
-
-          idx++;
-        }
-      }
+  // Copy the interpolated data into the mirrored views, in parallel on the host.
+  Kokkos::parallel_for("elliptica_fill",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, width),
+      [&](const int idx) {
+    int m   = idx / ncells_per_mb;
+    int rem = idx - m * ncells_per_mb;
+    int k   = rem / (ncells2 * ncells1);
+    rem    -= k * ncells2 * ncells1;
+    int j   = rem / ncells1;
+    int i   = rem % ncells1;
+
+    // Extract metric quantities
+    host_adm.alpha(m, k, j, i)     = idr->field[i_alpha][idx];
+    host_adm.beta_u(m, 0, k, j, i) = idr->field[i_betax][idx];
+    host_adm.beta_u(m, 1, k, j, i) = idr->field[i_betay][idx];
+    host_adm.beta_u(m, 2, k, j, i) = idr->field[i_betaz][idx];
+
+    Real g3d[NSPMETRIC];
+    host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = idr->field[i_gxx][idx];
+    host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = idr->field[i_gxy][idx];
+    host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = idr->field[i_gxz][idx];
+    host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = idr->field[i_gyy][idx];
+    host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = idr->field[i_gyz][idx];
+    host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = idr->field[i_gzz][idx];
+
+    host_adm.vK_dd(m, 0, 0, k, j, i) = idr->field[i_Kxx][idx];
+    host_adm.vK_dd(m, 0, 1, k, j, i) = idr->field[i_Kxy][idx];
+    host_adm.vK_dd(m, 0, 2, k, j, i) = idr->field[i_Kxz][idx];
+    host_adm.vK_dd(m, 1, 1, k, j, i) = idr->field[i_Kyy][idx];
+    host_adm.vK_dd(m, 1, 2, k, j, i) = idr->field[i_Kyz][idx];
+    host_adm.vK_dd(m, 2, 2, k, j, i) = idr->field[i_Kzz][idx];
+
+    // Extract hydro quantities
+    // Note that Elliptica does not necessarily use the same baryon rest-mass as
+    // AthenaK. The most reasonable thing to do, then, is to extract the total
+    // energy density, which is invariant, and use that with the 1D EOS.
+    Real egas = idr->field[i_rho][idx] * (1.0 + idr->field[i_eps][idx]);
+    Real &rho = host_w0(m, IDN, k, j, i);
+    rho = eos.template GetRhoFromE<tov::LocationTag::Host>(egas);
+    Real vu[3] = {idr->field[i_vx][idx],
+                  idr->field[i_vy][idx],
+                  idr->field[i_vz][idx]};
+
+    // Check for garbage values thrown in by Elliptica.
+    if (rho <= rho_cut || !Kokkos::isfinite(rho)) {
+      rho = 0.0;
+      host_w0(m, IPR, k, j, i) = 0.0;
+      vu[0] = 0.0;
+      vu[1] = 0.0;
+      vu[2] = 0.0;
     }
-  }
+
+    host_w0(m, IPR, k, j, i) = eos.template
+                                GetPFromRho<tov::LocationTag::Host>(rho);
+
+    // If the electron fraction is available, find it in the 1D EOS.
+    if constexpr (use_ye) {
+      host_w0(m, IYF, k, j, i) = eos.template
+                                 GetYeFromRho<tov::LocationTag::Host>(rho);
+    }
+
+    // Before we store the velocity, we need to make sure it's physical
+    // and calculate the Lorentz factor. If the velocity is superluminal,
+    // we make a last-ditch attempt to salvage the solution by rescaling
+    // it to vsq = 1.0 - 1e-15
+    Real vsq = Primitive::SquareVector(vu, g3d);
+    if (1.0 - vsq <= 0) {
+      std::cout << "The velocity is superluminal!" << std::endl
+                << "Attempting to adjust..." << std::endl;
+      Real fac = sqrt((1.0 - 1e-15) / vsq);
+      vu[0] *= fac;
+      vu[1] *= fac;
+      vu[2] *= fac;
+      vsq = 1.0 - 1.0e-15;
+    }
+    Real W = sqrt(1.0 / (1.0 - vsq));
+
+    host_w0(m, IVX, k, j, i) = W * vu[0];
+    host_w0(m, IVY, k, j, i) = W * vu[1];
+    host_w0(m, IVZ, k, j, i) = W * vu[2];
+  });
+  Kokkos::fence();
 
   if (global_variable::my_rank == 0) {
     std::cout << "Host mirrors filled." << std::endl;
@@ -370,6 +345,89 @@ void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
     CM_z_corr = idr->get_param_dbl("NSNS_z_CM",idr);
   }
 
+  params = {static_cast<Real>(BNS), static_cast<Real>(BHNS), sep,
+            NS_x, NS_y, NS_z, BH_x, BH_y, BH_z,
+            NS1_x, NS1_y, NS1_z, NS2_x, NS2_y, NS2_z,
+            CM_x_corr, CM_y_corr, CM_z_corr};
+
+  // Cleanup
+  elliptica_id_reader_free(idr);
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Elliptica freed." << std::endl;
+  }
+
+  // Copy the data to the GPU.
+  Kokkos::deep_copy(u_adm, host_u_adm);
+  Kokkos::deep_copy(w0, host_w0);
+  Kokkos::deep_copy(u_z4c, host_u_z4c);
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Data copied." << std::endl;
+  }
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_)
+//! \brief Setup of the BHNS/BNS binary with Elliptica
+template<class TOVEOS>
+void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  auto &indcs         = pmy_mesh_->mb_indcs;
+  auto &size          = pmbp->pmb->mb_size;
+  int &is             = indcs.is;
+  int &ie             = indcs.ie;
+  int &js             = indcs.js;
+  int &je             = indcs.je;
+  int &ks             = indcs.ks;
+  int &ke             = indcs.ke;
+
+  if (pmbp->pdyngr == nullptr || pmbp->pz4c == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl
+              << "BNS data requires <mhd> and <z4c> blocks." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  std::string fname = pin->GetString("problem", "initial_data_file");
+
+  // MHD parameters
+  Real gauss_cgs_to_geo = 8.3519664583273e+19;
+  Real b_max   = pin->GetOrAddReal("problem", "b_max", 1e12) / gauss_cgs_to_geo;
+  Real r_0     = pin->GetOrAddReal("problem", "r_0_current", 5.0);
+  Real I_0     = 4 * r_0 * b_max / (23.0 * M_PI);
+
+  int ncells1 = indcs.nx1 + 2 * (indcs.ng);
+  int ncells2 = indcs.nx2 + 2 * (indcs.ng);
+  int ncells3 = indcs.nx3 + 2 * (indcs.ng);
+  int nmb     = pmbp->nmb_thispack;
+
+  // Metric and primitives are read from the initial data cache if it is enabled
+  // (<problem>/id_cache_dir) and contains a snapshot for this ID file and mesh,
+  // otherwise they are interpolated from the Elliptica solution.  The parameters of the
+  // binary are stored in the cache as: BNS, BHNS, separation, NS center, BH center,
+  // NS1 center, NS2 center, and center of mass correction.
+  InitialDataCache id_cache(pin, pmy_mesh_, fname, {"mhd"});
+  std::vector<DvceArray5D<Real>> id_vars = {pmbp->padm->u_adm, pmbp->pmhd->w0,
+                                            pmbp->pz4c->u0};
+  std::vector<Real> params(18);
+  if (!id_cache.Load(id_vars, params)) {
+    ImportBinary<TOVEOS>(pin, pmy_mesh_, params);
+    id_cache.Save(id_vars, params);
+  }
+  bool BNS = (params[0] != 0.0);
+  bool BHNS = (params[1] != 0.0);
+  Real sep = params[2];
+  Real NS_x = params[3], NS_y = params[4], NS_z = params[5];
+  Real BH_x = params[6], BH_y = params[7], BH_z = params[8];
+  Real NS1_x = params[9], NS1_y = params[10], NS1_z = params[11];
+  Real NS2_x = params[12], NS2_y = params[13], NS2_z = params[14];
+  Real CM_x_corr = params[15];
+  Real CM_y_corr = params[16];
+  Real CM_z_corr = params[17];
+
   // The center of mass shift also needs to be adjusted within
   // the compact object tracker to accurately track the position
   // of the binary.
@@ -422,22 +480,6 @@ void SetupBinary(ParameterInput *pin, Mesh* pmy_mesh_) {
     }
   }
 
-  // Cleanup
-  elliptica_id_reader_free(idr);
-
-  if (global_variable::my_rank == 0) {
-    std::cout << "Elliptica freed." << std::endl;
-  }
-
-  // Copy the data to the GPU.
-  Kokkos::deep_copy(u_adm, host_u_adm);
-  Kokkos::deep_copy(w0, host_w0);
-  Kokkos::deep_copy(u_z4c, host_u_z4c);
-
-  if (global_variable::my_rank == 0) {
-    std::cout << "Data copied." << std::endl;
-  }
-
   // Compute vector potential over all faces
   DvceArray4D<Real> a1, a2, a3;
   Kokkos::realloc(a1, nmb, ncells3, ncells2, ncells1);
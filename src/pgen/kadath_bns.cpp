@@ -50,6 +50,7 @@
 #include "utils/tov/tov_polytrope.hpp"
 #include "utils/tov/tov_piecewise_poly.hpp"
 #include "utils/tov/tov_tabulated.hpp"
+#include "utils/id_cache.hpp"
 
 // Kadath FUKa
 #include "kadath_bin_ns.hpp"
@@ -65,11 +66,11 @@ void KadathBNSHistory(HistoryData *pdata, Mesh *pm);
 void KadathBNSRefinementCondition(MeshBlockPack *pmbp);
 
 //----------------------------------------------------------------------------------------
-//! \fn ProblemGenerator::UserProblem()
-//! \brief Problem generator for BNS with Kadath (FUKa)
-//void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
+//! \fn void ImportBNS()
+//! \brief Interpolates Kadath (FUKa) solution to all cells (including ghost zones) in the
+//! pack, and stores metric and primitives in u_adm, w0, and (gauge) z4c u0 on the device.
 template<class TOVEOS>
-void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
+void ImportBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
   // export_utils: field-index enumerators
   using export_utils::PSI;
   using export_utils::ALP;
@@ -92,11 +93,8 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
   auto &indcs         = pmy_mesh_->mb_indcs;
   auto &size          = pmbp->pmb->mb_size;
   int &is             = indcs.is;
-  int &ie             = indcs.ie;
   int &js             = indcs.js;
-  int &je             = indcs.je;
   int &ks             = indcs.ks;
-  int &ke             = indcs.ke;
 
   std::string fname = pin->GetString("problem", "initial_data_file");
 
@@ -417,6 +415,39 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
   Kokkos::deep_copy(u_adm, host_u_adm);
   Kokkos::deep_copy(w0, host_w0);
   Kokkos::deep_copy(u_z4c, host_u_z4c);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SetupBNS()
+//! \brief Problem generator for BNS with Kadath (FUKa)
+template<class TOVEOS>
+void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  auto &indcs         = pmy_mesh_->mb_indcs;
+  int &is             = indcs.is;
+  int &ie             = indcs.ie;
+  int &js             = indcs.js;
+  int &je             = indcs.je;
+  int &ks             = indcs.ks;
+  int &ke             = indcs.ke;
+
+  int ncells1      = indcs.nx1 + 2 * (indcs.ng);
+  int ncells2      = indcs.nx2 + 2 * (indcs.ng);
+  int ncells3      = indcs.nx3 + 2 * (indcs.ng);
+  int nmb          = pmbp->nmb_thispack;
+
+  // Metric and primitives are read from the initial data cache if it is enabled
+  // (<problem>/id_cache_dir) and contains a snapshot for this ID file and mesh,
+  // otherwise they are interpolated from the Kadath solution.
+  std::string fname = pin->GetString("problem", "initial_data_file");
+  InitialDataCache id_cache(pin, pmy_mesh_, fname, {"mhd"});
+  std::vector<DvceArray5D<Real>> id_vars = {pmbp->padm->u_adm, pmbp->pmhd->w0,
+                                            pmbp->pz4c->u0};
+  std::vector<Real> id_scalars;
+  if (!id_cache.Load(id_vars, id_scalars)) {
+    ImportBNS<TOVEOS>(pin, pmy_mesh_);
+    id_cache.Save(id_vars, id_scalars);
+  }
 
   // TODO(user): Add magnetic field initialization (e.g., current-loop model).
   // For now, initialize face-centered and cell-centered B fields to zero.
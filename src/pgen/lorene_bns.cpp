@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -35,6 +36,7 @@
 #include "utils/tov/tov_polytrope.hpp"
 #include "utils/tov/tov_piecewise_poly.hpp"
 #include "utils/tov/tov_tabulated.hpp"
+#include "utils/id_cache.hpp"
 
 // Lorene
 #include "bin_ns.h"
@@ -50,14 +52,20 @@ static Real A1(Real x, Real y, Real z, Real I_0, Real r_0);
 KOKKOS_INLINE_FUNCTION
 static Real A2(Real x, Real y, Real z, Real I_0, Real r_0);
 
+//----------------------------------------------------------------------------------------
+//! \fn Real ImportBNS()
+//! \brief Interpolates LORENE solution to all cells (including ghost zones) in the pack,
+//! and stores metric and primitives in u_adm, w0, and (gauge) z4c u0 on the device.
+//! Returns separation of the two stars in code units.
+
 template<class TOVEOS>
-void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
+Real ImportBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
   MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
   auto &indcs = pmy_mesh_->mb_indcs;
   auto &size = pmbp->pmb->mb_size;
-  int &is = indcs.is; int &ie = indcs.ie;
-  int &js = indcs.js; int &je = indcs.je;
-  int &ks = indcs.ks; int &ke = indcs.ke;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
 
   // Conversion constants to translate between Lorene and AthenaK
   const Real c_light  = Lorene::Unites::c_si;      // speed of light [m/s]
@@ -82,9 +90,6 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
 
   std::string fname = pin->GetString("problem", "initial_data_file");
   Real rho_cut = pin->GetOrAddReal("problem", "rho_cut", 1e-5);
-  Real b_max = pin->GetOrAddReal("problem", "b_max", 1e12) / 8.3519664583273e+19;
-  Real r_0 = pin->GetOrAddReal("problem", "r_0_current", 5.0);
-  Real I_0 = 4*r_0*b_max/(23.0*M_PI);
 
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
   int ncells2 = indcs.nx2 + 2*(indcs.ng);
@@ -108,37 +113,24 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
   }
 
   // Populate coordinates for LORENE
-  int idx = 0;
-  for (int m = 0; m < nmb; m++) {
-    Real &x1min = size.h_view(m).x1min;
-    Real &x1max = size.h_view(m).x1max;
-    int nx1 = indcs.nx1;
-
-    Real &x2min = size.h_view(m).x2min;
-    Real &x2max = size.h_view(m).x2max;
-    int nx2 = indcs.nx2;
-
-    Real &x3min = size.h_view(m).x3min;
-    Real &x3max = size.h_view(m).x3max;
-    int nx3 = indcs.nx3;
-
-    for (int k = 0; k < ncells3; k++) {
-      Real z = CellCenterX(k - ks, nx3, x3min, x3max);
-      for (int j = 0; j < ncells2; j++) {
-        Real y = CellCenterX(j - js, nx2, x2min, x2max);
-        for (int i = 0; i < ncells1; i++) {
-          Real x = CellCenterX(i - is, nx1, x1min, x1max);
-
-          x_coords[idx] = coord_unit*x;
-          y_coords[idx] = coord_unit*y;
-          z_coords[idx] = coord_unit*z;
-
-          // Increment flat index
-          idx++;
-        }
-      }
-    }
-  }
+  int ncells_per_mb = ncells3*ncells2*ncells1;
+  Kokkos::parallel_for("lorene_coords",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, width),
+      [&](const int idx) {
+    int m = idx/ncells_per_mb;
+    int rem = idx - m*ncells_per_mb;
+    int k = rem/(ncells2*ncells1);
+    rem -= k*ncells2*ncells1;
+    int j = rem/ncells1;
+    int i = rem%ncells1;
+
+    x_coords[idx] = coord_unit*CellCenterX(i - is, indcs.nx1, size.h_view(m).x1min,
+                                           size.h_view(m).x1max);
+    y_coords[idx] = coord_unit*CellCenterX(j - js, indcs.nx2, size.h_view(m).x2min,
+                                           size.h_view(m).x2max);
+    z_coords[idx] = coord_unit*CellCenterX(k - ks, indcs.nx3, size.h_view(m).x3min,
+                                           size.h_view(m).x3max);
+  });
 
   // Interpolate the data
   if (global_variable::my_rank == 0) {
@@ -187,93 +179,155 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
     std::cout << "Host mirrors created." << std::endl;
   }
 
-  // Copy the interpolated data into the mirrored views.
-  idx = 0;
-  for (int m = 0; m < nmb; m++) {
-    for (int k = 0; k < ncells3; k++) {
-      for (int j = 0; j < ncells2; j++) {
-        for (int i = 0; i < ncells1; i++) {
-          // Extract metric quantities
-          host_adm.alpha(m, k, j, i) = bns->nnn[idx];
-          host_adm.beta_u(m, 0, k, j, i) = -bns->beta_x[idx];
-          host_adm.beta_u(m, 1, k, j, i) = -bns->beta_y[idx];
-          host_adm.beta_u(m, 2, k, j, i) = -bns->beta_z[idx];
-
-          Real g3d[NSPMETRIC];
-          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = bns->g_xx[idx];
-          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = bns->g_xy[idx];
-          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = bns->g_xz[idx];
-          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = bns->g_yy[idx];
-          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = bns->g_yz[idx];
-          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = bns->g_zz[idx];
-
-          host_adm.vK_dd(m, 0, 0, k, j, i) = coord_unit * bns->k_xx[idx];
-          host_adm.vK_dd(m, 0, 1, k, j, i) = coord_unit * bns->k_xy[idx];
-          host_adm.vK_dd(m, 0, 2, k, j, i) = coord_unit * bns->k_xz[idx];
-          host_adm.vK_dd(m, 1, 1, k, j, i) = coord_unit * bns->k_yy[idx];
-          host_adm.vK_dd(m, 1, 2, k, j, i) = coord_unit * bns->k_yz[idx];
-          host_adm.vK_dd(m, 2, 2, k, j, i) = coord_unit * bns->k_zz[idx];
-
-          // Extract hydro quantities
-          // Note that Lorene does not necessarily use the same baryon rest-mass as
-          // AthenaK. The most reasonable thing to do, then, is to extract the total
-          // energy density, which is invariant, and use that with the 1D EOS.
-          Real egas = bns->nbar[idx]*(1.0 + bns->ener_spec[idx] / ener_unit)/rho_unit;
-          Real& rho = host_w0(m, IDN, k, j, i);
-          rho = eos.template GetRhoFromE<tov::LocationTag::Host>(egas);
-          Real vu[3] = {bns->u_euler_x[idx] / vel_unit,
-                        bns->u_euler_y[idx] / vel_unit,
-                        bns->u_euler_z[idx] / vel_unit};
-
-          // Check for garbage values thrown in by Lorene.
-          if (rho <= rho_cut || !Kokkos::isfinite(rho)) {
-            rho = 0.0;
-            host_w0(m, IPR, k, j, i) = 0.0;
-            vu[0] = 0.0;
-            vu[1] = 0.0;
-            vu[2] = 0.0;
-          }
-
-          host_w0(m, IPR, k, j, i) = eos.template
-                                     GetPFromRho<tov::LocationTag::Host>(rho);
-
-          // If the electron fraction is available, find it in the 1D EOS.
-          if constexpr (use_ye) {
-            host_w0(m, IYF, k, j, i) = eos.template
-                                       GetYeFromRho<tov::LocationTag::Host>(rho);
-          }
-
-          // Before we store the velocity, we need to make sure it's physical and
-          // calculate the Lorentz factor. If the velocity is superluminal, we make a
-          // last-ditch attempt to salvage the solution by rescaling it to
-          // vsq = 1.0 - 1e-15
-          Real vsq = Primitive::SquareVector(vu, g3d);
-          if (1.0 - vsq <= 0) {
-            std::cout << "The velocity is superluminal!" << std::endl
-                      << "Attempting to adjust..." << std::endl;
-            Real fac = Kokkos::sqrt((1.0 - 1e-15)/vsq);
-            vu[0] *= fac;
-            vu[1] *= fac;
-            vu[2] *= fac;
-            vsq = 1.0 - 1.0e-15;
-          }
-          Real W = Kokkos::sqrt(1.0 / (1.0 - vsq));
-
-          host_w0(m, IVX, k, j, i) = W*vu[0];
-          host_w0(m, IVY, k, j, i) = W*vu[1];
-          host_w0(m, IVZ, k, j, i) = W*vu[2];
-
-          idx++;
-        }
-      }
+  // Copy the interpolated data into the mirrored views, in parallel on the host.
+  Kokkos::parallel_for("lorene_fill",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, width),
+      [&](const int idx) {
+    int m = idx/ncells_per_mb;
+    int rem = idx - m*ncells_per_mb;
+    int k = rem/(ncells2*ncells1);
+    rem -= k*ncells2*ncells1;
+    int j = rem/ncells1;
+    int i = rem%ncells1;
+
+    // Extract metric quantities
+    host_adm.alpha(m, k, j, i) = bns->nnn[idx];
+    host_adm.beta_u(m, 0, k, j, i) = -bns->beta_x[idx];
+    host_adm.beta_u(m, 1, k, j, i) = -bns->beta_y[idx];
+    host_adm.beta_u(m, 2, k, j, i) = -bns->beta_z[idx];
+
+    Real g3d[NSPMETRIC];
+    host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = bns->g_xx[idx];
+    host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = bns->g_xy[idx];
+    host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = bns->g_xz[idx];
+    host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = bns->g_yy[idx];
+    host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = bns->g_yz[idx];
+    host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = bns->g_zz[idx];
+
+    host_adm.vK_dd(m, 0, 0, k, j, i) = coord_unit * bns->k_xx[idx];
+    host_adm.vK_dd(m, 0, 1, k, j, i) = coord_unit * bns->k_xy[idx];
+    host_adm.vK_dd(m, 0, 2, k, j, i) = coord_unit * bns->k_xz[idx];
+    host_adm.vK_dd(m, 1, 1, k, j, i) = coord_unit * bns->k_yy[idx];
+    host_adm.vK_dd(m, 1, 2, k, j, i) = coord_unit * bns->k_yz[idx];
+    host_adm.vK_dd(m, 2, 2, k, j, i) = coord_unit * bns->k_zz[idx];
+
+    // Extract hydro quantities
+    // Note that Lorene does not necessarily use the same baryon rest-mass as
+    // AthenaK. The most reasonable thing to do, then, is to extract the total
+    // energy density, which is invariant, and use that with the 1D EOS.
+    Real egas = bns->nbar[idx]*(1.0 + bns->ener_spec[idx] / ener_unit)/rho_unit;
+    Real& rho = host_w0(m, IDN, k, j, i);
+    rho = eos.template GetRhoFromE<tov::LocationTag::Host>(egas);
+    Real vu[3] = {bns->u_euler_x[idx] / vel_unit,
+                  bns->u_euler_y[idx] / vel_unit,
+                  bns->u_euler_z[idx] / vel_unit};
+
+    // Check for garbage values thrown in by Lorene.
+    if (rho <= rho_cut || !Kokkos::isfinite(rho)) {
+      rho = 0.0;
+      host_w0(m, IPR, k, j, i) = 0.0;
+      vu[0] = 0.0;
+      vu[1] = 0.0;
+      vu[2] = 0.0;
     }
-  }
+
+    host_w0(m, IPR, k, j, i) = eos.template
+                               GetPFromRho<tov::LocationTag::Host>(rho);
+
+    // If the electron fraction is available, find it in the 1D EOS.
+    if constexpr (use_ye) {
+      host_w0(m, IYF, k, j, i) = eos.template
+                                 GetYeFromRho<tov::LocationTag::Host>(rho);
+    }
+
+    // Before we store the velocity, we need to make sure it's physical and
+    // calculate the Lorentz factor. If the velocity is superluminal, we make a
+    // last-ditch attempt to salvage the solution by rescaling it to
+    // vsq = 1.0 - 1e-15
+    Real vsq = Primitive::SquareVector(vu, g3d);
+    if (1.0 - vsq <= 0) {
+      std::cout << "The velocity is superluminal!" << std::endl
+                << "Attempting to adjust..." << std::endl;
+      Real fac = Kokkos::sqrt((1.0 - 1e-15)/vsq);
+      vu[0] *= fac;
+      vu[1] *= fac;
+      vu[2] *= fac;
+      vsq = 1.0 - 1.0e-15;
+    }
+    Real W = Kokkos::sqrt(1.0 / (1.0 - vsq));
+
+    host_w0(m, IVX, k, j, i) = W*vu[0];
+    host_w0(m, IVY, k, j, i) = W*vu[1];
+    host_w0(m, IVZ, k, j, i) = W*vu[2];
+  });
+  Kokkos::fence();
 
   if (global_variable::my_rank == 0) {
     std::cout << "Host mirrors filled." << std::endl;
   }
 
   Real sep = bns->dist/coord_unit;
+
+  // Cleanup
+  delete bns;
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Lorene freed." << std::endl;
+  }
+
+  // Copy the data to the GPU.
+  Kokkos::deep_copy(u_adm, host_u_adm);
+  Kokkos::deep_copy(w0, host_w0);
+  if (pmbp->pz4c != nullptr) {
+    Kokkos::deep_copy(pmbp->pz4c->u0, host_u_z4c);
+  }
+
+  if (global_variable::my_rank == 0) {
+    std::cout << "Data copied." << std::endl;
+  }
+
+  return sep;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SetupBNS()
+//! \brief Sets metric and primitives from LORENE solution (or from the initial data
+//! cache), positions of the compact object trackers, and magnetic field in both stars.
+
+template<class TOVEOS>
+void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  auto &indcs = pmy_mesh_->mb_indcs;
+  auto &size = pmbp->pmb->mb_size;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+
+  std::string fname = pin->GetString("problem", "initial_data_file");
+  Real b_max = pin->GetOrAddReal("problem", "b_max", 1e12) / 8.3519664583273e+19;
+  Real r_0 = pin->GetOrAddReal("problem", "r_0_current", 5.0);
+  Real I_0 = 4*r_0*b_max/(23.0*M_PI);
+
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = indcs.nx2 + 2*(indcs.ng);
+  int ncells3 = indcs.nx3 + 2*(indcs.ng);
+  int nmb = pmbp->nmb_thispack;
+
+  // Metric and primitives are read from the initial data cache if it is enabled
+  // (<problem>/id_cache_dir) and contains a snapshot for this ID file and mesh.  Only
+  // the separation of the stars is needed from LORENE otherwise.
+  InitialDataCache id_cache(pin, pmy_mesh_, fname, {"mhd"});
+  std::vector<DvceArray5D<Real>> id_vars = {pmbp->padm->u_adm, pmbp->pmhd->w0};
+  if (pmbp->pz4c != nullptr) {
+    id_vars.push_back(pmbp->pz4c->u0);
+  }
+  std::vector<Real> id_scalars(1);
+  if (!id_cache.Load(id_vars, id_scalars)) {
+    id_scalars[0] = ImportBNS<TOVEOS>(pin, pmy_mesh_);
+    id_cache.Save(id_vars, id_scalars);
+  }
+
+  Real sep = id_scalars[0];
   if (global_variable::my_rank == 0) {
     std::cout << "sep = " << sep << std::endl;
   }
@@ -303,24 +357,6 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
               << ", cz = " << pmbp->pz4c->ptracker[1]->GetPos(2) << std::endl;
   }
 
-  // Cleanup
-  delete bns;
-
-  if (global_variable::my_rank == 0) {
-    std::cout << "Lorene freed." << std::endl;
-  }
-
-  // Copy the data to the GPU.
-  Kokkos::deep_copy(u_adm, host_u_adm);
-  Kokkos::deep_copy(w0, host_w0);
-  if (pmbp->pz4c != nullptr) {
-    Kokkos::deep_copy(pmbp->pz4c->u0, host_u_z4c);
-  }
-
-  if (global_variable::my_rank == 0) {
-    std::cout << "Data copied." << std::endl;
-  }
-
   // compute vector potential over all faces
   DvceArray4D<Real> a1, a2, a3;
   Kokkos::realloc(a1, nmb,ncells3,ncells2,ncells1);
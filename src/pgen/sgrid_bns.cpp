@@ -15,6 +15,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/adm.hpp"
@@ -29,6 +30,7 @@
 #include "parameter_input.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
+#include "utils/id_cache.hpp"
 
 // libsgrid
 // Functions protoypes are "SGRID_*"
@@ -98,6 +100,8 @@ enum {
 };
 
 namespace {
+void ImportSGRID(ParameterInput *pin, Mesh *pmy_mesh_);
+
 // Utilities wrapping various SGRID DNS calls (DNS_*)
 void DNS_init_sgrid(ParameterInput *pin);
 int DNS_position_fileptr_after_str(FILE *in, const char *str);
@@ -128,7 +132,6 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
   MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
   auto &indcs = pmy_mesh_->mb_indcs;
-  auto &size = pmbp->pmb->mb_size;
   int &is = indcs.is;
   int &ie = indcs.ie;
   int &js = indcs.js;
@@ -143,6 +146,162 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
     exit(EXIT_FAILURE);
   }
 
+  const bool verbose = pin->GetOrAddBoolean("problem", "verbose", false);
+  int ncells1 = indcs.nx1 + 2 * (indcs.ng);
+  int ncells2 = indcs.nx2 + 2 * (indcs.ng);
+  int ncells3 = indcs.nx3 + 2 * (indcs.ng);
+  int nmb = pmbp->nmb_thispack;
+
+  // Metric and primitives are read from the initial data cache if it is enabled
+  // (<problem>/id_cache_dir) and contains a snapshot for this SGRID data directory and
+  // mesh, otherwise they are interpolated from the SGRID solution.
+  InitialDataCache id_cache(pin, pmy_mesh_, pin->GetString("problem", "datadir"),
+                            {"mhd"});
+  std::vector<DvceArray5D<Real>> id_vars = {pmbp->padm->u_adm, pmbp->pmhd->w0,
+                                            pmbp->pz4c->u0};
+  std::vector<Real> id_scalars;
+  if (!id_cache.Load(id_vars, id_scalars)) {
+    ImportSGRID(pin, pmy_mesh_);
+    id_cache.Save(id_vars, id_scalars);
+  }
+
+  // TODO(JMF): Add magnetic fields
+  auto &b0 = pmbp->pmhd->b0;
+  par_for(
+      "pgen_Bfc", DevExeSpace(), 0, nmb - 1, ks, ke, js, je, is, ie,
+      KOKKOS_LAMBDA(int m, int k, int j, int i) {
+        b0.x1f(m, k, j, i) = 0.0;
+        b0.x2f(m, k, j, i) = 0.0;
+        b0.x3f(m, k, j, i) = 0.0;
+
+        if (i == ie) {
+          b0.x1f(m, k, j, i + 1) = 0.0;
+        }
+        if (j == je) {
+          b0.x2f(m, k, j + 1, i) = 0.0;
+        }
+        if (k == ke) {
+          b0.x3f(m, k + 1, j, i) = 0.0;
+        }
+      });
+
+  if (verbose)
+    std::cout << "Face-centered fields zeroed." << std::endl;
+
+  // Compute cell-centered fields
+  auto &bcc0 = pmbp->pmhd->bcc0;
+  par_for(
+      "pgen_bcc", DevExeSpace(), 0, nmb - 1, ks, ke, js, je, is, ie,
+      KOKKOS_LAMBDA(int m, int k, int j, int i) {
+        bcc0(m, IBX, k, j, i) =
+            0.5 * (b0.x1f(m, k, j, i) + b0.x1f(m, k, j, i + 1));
+        bcc0(m, IBY, k, j, i) =
+            0.5 * (b0.x2f(m, k, j, i) + b0.x2f(m, k, j + 1, i));
+        bcc0(m, IBZ, k, j, i) =
+            0.5 * (b0.x3f(m, k, j, i) + b0.x3f(m, k + 1, j, i));
+      });
+
+  if (verbose)
+    std::cout << "Cell-centered fields calculated." << std::endl;
+
+  pmbp->pdyngr->PrimToConInit(0, (ncells1 - 1), 0, (ncells2 - 1), 0,
+                              (ncells3 - 1));
+  switch (indcs.ng) {
+  case 2:
+    pmbp->pz4c->ADMToZ4c<2>(pmbp, pin);
+    break;
+  case 3:
+    pmbp->pz4c->ADMToZ4c<3>(pmbp, pin);
+    break;
+  case 4:
+    pmbp->pz4c->ADMToZ4c<4>(pmbp, pin);
+    break;
+  }
+
+  return;
+}
+
+// History function
+void SGRIDHistory(HistoryData *pdata, Mesh *pm) {
+  // Select the number of outputs and create labels for them.
+  pdata->nhist = 2;
+  pdata->label[0] = "rho-max";
+  pdata->label[1] = "alpha-min";
+
+  // capture class variables for kernel
+  auto &w0_ = pm->pmb_pack->pmhd->w0;
+  auto &adm = pm->pmb_pack->padm->adm;
+
+  // loop over all MeshBlocks in this pack
+  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
+  int is = indcs.is;
+  int nx1 = indcs.nx1;
+  int js = indcs.js;
+  int nx2 = indcs.nx2;
+  int ks = indcs.ks;
+  int nx3 = indcs.nx3;
+  const int nmkji = (pm->pmb_pack->nmb_thispack) * nx3 * nx2 * nx1;
+  const int nkji = nx3 * nx2 * nx1;
+  const int nji = nx2 * nx1;
+  Real rho_max = std::numeric_limits<Real>::max();
+  Real alpha_min = -rho_max;
+  Kokkos::parallel_reduce(
+      "BNSHistSums", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+      KOKKOS_LAMBDA(const int &idx, Real &mb_max, Real &mb_alp_min) {
+        // compute n,k,j,i indices of thread
+        int m = (idx) / nkji;
+        int k = (idx - m * nkji) / nji;
+        int j = (idx - m * nkji - k * nji) / nx1;
+        int i = (idx - m * nkji - k * nji - j * nx1) + is;
+        k += ks;
+        j += js;
+
+        mb_max = fmax(mb_max, w0_(m, IDN, k, j, i));
+        mb_alp_min = fmin(mb_alp_min, adm.alpha(m, k, j, i));
+      },
+      Kokkos::Max<Real>(rho_max), Kokkos::Min<Real>(alpha_min));
+
+  // Currently AthenaK only supports MPI_SUM operations between ranks, but we
+  // need MPI_MAX and MPI_MIN operations instead. This is a cheap hack to make
+  // it work as intended.
+#if MPI_PARALLEL_ENABLED
+  if (global_variable::my_rank == 0) {
+    MPI_Reduce(MPI_IN_PLACE, &rho_max, 1, MPI_ATHENA_REAL, MPI_MAX, 0,
+               MPI_COMM_WORLD);
+    MPI_Reduce(MPI_IN_PLACE, &alpha_min, 1, MPI_ATHENA_REAL, MPI_MIN, 0,
+               MPI_COMM_WORLD);
+  } else {
+    MPI_Reduce(&rho_max, &rho_max, 1, MPI_ATHENA_REAL, MPI_MAX, 0,
+               MPI_COMM_WORLD);
+    MPI_Reduce(&alpha_min, &alpha_min, 1, MPI_ATHENA_REAL, MPI_MAX, 0,
+               MPI_COMM_WORLD);
+    rho_max = 0.;
+    alpha_min = 0.;
+  }
+#endif
+
+  // store data in hdata array
+  pdata->hdata[0] = rho_max;
+  pdata->hdata[1] = alpha_min;
+}
+
+void SGRIDRefinementCondition(MeshBlockPack *pmbp) {
+  pmbp->pz4c->pamr->Refine(pmbp);
+}
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn void ImportSGRID(ParameterInput *pin, Mesh *pmy_mesh_)
+//! \brief Interpolates SGRID solution to all cells (including ghost zones) in the pack,
+//! and stores metric and primitives in u_adm, w0, and (gauge) z4c u0 on the device.
+void ImportSGRID(ParameterInput *pin, Mesh *pmy_mesh_) {
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  auto &indcs = pmy_mesh_->mb_indcs;
+  auto &size = pmbp->pmb->mb_size;
+  int &is = indcs.is;
+  int &js = indcs.js;
+  int &ks = indcs.ks;
+
   //
   // Initialize the data reader
   DNS_init_sgrid(pin);
@@ -348,132 +507,8 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
   if (verbose)
     std::cout << "Data copied." << std::endl;
-
-  // TODO(JMF): Add magnetic fields
-  auto &b0 = pmbp->pmhd->b0;
-  par_for(
-      "pgen_Bfc", DevExeSpace(), 0, nmb - 1, ks, ke, js, je, is, ie,
-      KOKKOS_LAMBDA(int m, int k, int j, int i) {
-        b0.x1f(m, k, j, i) = 0.0;
-        b0.x2f(m, k, j, i) = 0.0;
-        b0.x3f(m, k, j, i) = 0.0;
-
-        if (i == ie) {
-          b0.x1f(m, k, j, i + 1) = 0.0;
-        }
-        if (j == je) {
-          b0.x2f(m, k, j + 1, i) = 0.0;
-        }
-        if (k == ke) {
-          b0.x3f(m, k + 1, j, i) = 0.0;
-        }
-      });
-
-  if (verbose)
-    std::cout << "Face-centered fields zeroed." << std::endl;
-
-  // Compute cell-centered fields
-  auto &bcc0 = pmbp->pmhd->bcc0;
-  par_for(
-      "pgen_bcc", DevExeSpace(), 0, nmb - 1, ks, ke, js, je, is, ie,
-      KOKKOS_LAMBDA(int m, int k, int j, int i) {
-        bcc0(m, IBX, k, j, i) =
-            0.5 * (b0.x1f(m, k, j, i) + b0.x1f(m, k, j, i + 1));
-        bcc0(m, IBY, k, j, i) =
-            0.5 * (b0.x2f(m, k, j, i) + b0.x2f(m, k, j + 1, i));
-        bcc0(m, IBZ, k, j, i) =
-            0.5 * (b0.x3f(m, k, j, i) + b0.x3f(m, k + 1, j, i));
-      });
-
-  if (verbose)
-    std::cout << "Cell-centered fields calculated." << std::endl;
-
-  pmbp->pdyngr->PrimToConInit(0, (ncells1 - 1), 0, (ncells2 - 1), 0,
-                              (ncells3 - 1));
-  switch (indcs.ng) {
-  case 2:
-    pmbp->pz4c->ADMToZ4c<2>(pmbp, pin);
-    break;
-  case 3:
-    pmbp->pz4c->ADMToZ4c<3>(pmbp, pin);
-    break;
-  case 4:
-    pmbp->pz4c->ADMToZ4c<4>(pmbp, pin);
-    break;
-  }
-
-  return;
 }
 
-// History function
-void SGRIDHistory(HistoryData *pdata, Mesh *pm) {
-  // Select the number of outputs and create labels for them.
-  pdata->nhist = 2;
-  pdata->label[0] = "rho-max";
-  pdata->label[1] = "alpha-min";
-
-  // capture class variables for kernel
-  auto &w0_ = pm->pmb_pack->pmhd->w0;
-  auto &adm = pm->pmb_pack->padm->adm;
-
-  // loop over all MeshBlocks in this pack
-  auto &indcs = pm->pmb_pack->pmesh->mb_indcs;
-  int is = indcs.is;
-  int nx1 = indcs.nx1;
-  int js = indcs.js;
-  int nx2 = indcs.nx2;
-  int ks = indcs.ks;
-  int nx3 = indcs.nx3;
-  const int nmkji = (pm->pmb_pack->nmb_thispack) * nx3 * nx2 * nx1;
-  const int nkji = nx3 * nx2 * nx1;
-  const int nji = nx2 * nx1;
-  Real rho_max = std::numeric_limits<Real>::max();
-  Real alpha_min = -rho_max;
-  Kokkos::parallel_reduce(
-      "BNSHistSums", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-      KOKKOS_LAMBDA(const int &idx, Real &mb_max, Real &mb_alp_min) {
-        // compute n,k,j,i indices of thread
-        int m = (idx) / nkji;
-        int k = (idx - m * nkji) / nji;
-        int j = (idx - m * nkji - k * nji) / nx1;
-        int i = (idx - m * nkji - k * nji - j * nx1) + is;
-        k += ks;
-        j += js;
-
-        mb_max = fmax(mb_max, w0_(m, IDN, k, j, i));
-        mb_alp_min = fmin(mb_alp_min, adm.alpha(m, k, j, i));
-      },
-      Kokkos::Max<Real>(rho_max), Kokkos::Min<Real>(alpha_min));
-
-  // Currently AthenaK only supports MPI_SUM operations between ranks, but we
-  // need MPI_MAX and MPI_MIN operations instead. This is a cheap hack to make
-  // it work as intended.
-#if MPI_PARALLEL_ENABLED
-  if (global_variable::my_rank == 0) {
-    MPI_Reduce(MPI_IN_PLACE, &rho_max, 1, MPI_ATHENA_REAL, MPI_MAX, 0,
-               MPI_COMM_WORLD);
-    MPI_Reduce(MPI_IN_PLACE, &alpha_min, 1, MPI_ATHENA_REAL, MPI_MIN, 0,
-               MPI_COMM_WORLD);
-  } else {
-    MPI_Reduce(&rho_max, &rho_max, 1, MPI_ATHENA_REAL, MPI_MAX, 0,
-               MPI_COMM_WORLD);
-    MPI_Reduce(&alpha_min, &alpha_min, 1, MPI_ATHENA_REAL, MPI_MAX, 0,
-               MPI_COMM_WORLD);
-    rho_max = 0.;
-    alpha_min = 0.;
-  }
-#endif
-
-  // store data in hdata array
-  pdata->hdata[0] = rho_max;
-  pdata->hdata[1] = alpha_min;
-}
-
-void SGRIDRefinementCondition(MeshBlockPack *pmbp) {
-  pmbp->pz4c->pamr->Refine(pmbp);
-}
-
-namespace {
 
 //----------------------------------------------------------------------------------------
 //! \fn void DNS_init_sgrid(ParameterInput *pin)
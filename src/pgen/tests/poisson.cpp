@@ -0,0 +1,183 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file poisson.cpp
+//! \brief problem generator for tests and benchmarks of the multigrid Poisson solver used
+//! for self-gravity.  Sets a density d0 + amp*sin(k1 x1)*sin(k2 x2)*sin(k3 x3) (one
+//! wavelength across the domain in each active direction), for which the potential is
+//! phi = -four_pi_G*amp*sin(k1 x1)*sin(k2 x2)*sin(k3 x3)/(k1^2 + k2^2 + k3^2).  With
+//! periodic BCs the mean density d0 is subtracted by the solver.  With u=0 BCs (any other
+//! BC) the domain must span [-L/2,L/2] in each direction, and d0 must be zero.
+//!
+//! The potential is computed 'nsolve' times, and the number of V-cycles, the mean
+//! reduction of the defect per V-cycle, the time per solve, and the L1 and L-infty
+//! errors of phi are printed, and appended to the file basename-errs.dat.  Intended to be
+//! run with <time>/evolution=static.
+
+// C++ headers
+#include <cmath>      // sin(), fabs()
+#include <cstdio>     // fopen(), fprintf(), freopen()
+#include <iostream>   // endl
+#include <string>     // c_str()
+
+// Athena++ headers
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "hydro/hydro.hpp"
+#include "gravity/gravity.hpp"
+#include "multigrid/multigrid.hpp"
+#include "pgen/pgen.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \fn ProblemGenerator::Poisson()
+//! \brief sets sinusoidal density, solves for potential, and outputs errors and timing
+
+void ProblemGenerator::Poisson(ParameterInput *pin, const bool restart) {
+  if (restart) return;
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  if (pmbp->pgrav == nullptr || pmbp->phydro == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Poisson test requires <hydro> and <gravity> blocks" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  Real d0 = pin->GetOrAddReal("problem", "d0", 1.0);
+  Real amp = pin->GetOrAddReal("problem", "amp", 1.0);
+  int nsolve = pin->GetOrAddInteger("problem", "nsolve", 10);
+
+  // capture variables for the kernel
+  auto &indcs = pmy_mesh_->mb_indcs;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  auto &ms = pmy_mesh_->mesh_size;
+  auto &size = pmbp->pmb->mb_size;
+  bool multi_d = pmy_mesh_->multi_d, three_d = pmy_mesh_->three_d;
+  Real k1 = 2.0*M_PI/(ms.x1max - ms.x1min);
+  Real k2 = (multi_d)? 2.0*M_PI/(ms.x2max - ms.x2min) : 0.0;
+  Real k3 = (three_d)? 2.0*M_PI/(ms.x3max - ms.x3min) : 0.0;
+  Real phi_amp = -(pmbp->pgrav->four_pi_G)*amp/(SQR(k1) + SQR(k2) + SQR(k3));
+
+  // Initialize Hydro variables (fluid at rest with uniform pressure)
+  EOS_Data &eos = pmbp->phydro->peos->eos_data;
+  Real p0 = 1.0;
+  auto &u0 = pmbp->phydro->u0;
+  par_for("pgen_poisson", DevExeSpace(),0,(pmbp->nmb_thispack-1),ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real x1v = CellCenterX(i-is, nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    Real x2v = CellCenterX(j-js, nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    Real x3v = CellCenterX(k-ks, nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+    Real prof = sin(k1*x1v);
+    if (multi_d) {prof *= sin(k2*x2v);}
+    if (three_d) {prof *= sin(k3*x3v);}
+    u0(m,IDN,k,j,i) = d0 + amp*prof;
+    u0(m,IM1,k,j,i) = 0.0;
+    u0(m,IM2,k,j,i) = 0.0;
+    u0(m,IM3,k,j,i) = 0.0;
+    if (eos.is_ideal) {
+      u0(m,IEN,k,j,i) = p0/(eos.gamma - 1.0);
+    }
+  });
+
+  // solve nsolve times
+  gravity::Gravity *pgrav = pmbp->pgrav;
+  Multigrid *pmg = pgrav->pmg;
+  for (int n=0; n<nsolve; ++n) {
+    pgrav->Solve();
+    if (global_variable::my_rank == 0 && n == 0) {
+      std::cout << std::endl << "Multigrid Poisson solver: " << pmg->niterations
+                << " V-cycles after FMG, defect reduction/V-cycle = " << pmg->conv_factor
+                << ", |defect|/|src| = " << pmg->defect_norm/pmg->src_norm << std::endl;
+    }
+  }
+  Real time_per_solve = pgrav->solve_time/static_cast<Real>(pgrav->nsolve);
+  Real ncells = static_cast<Real>(pmy_mesh_->nmb_total)*nx1*nx2*nx3;
+  if (global_variable::my_rank == 0) {
+    std::cout << "time per solve = " << time_per_solve << " s, cell-solves/second = "
+              << ncells/time_per_solve << std::endl;
+  }
+
+  // compute errors in potential
+  const int nmkji = (pmbp->nmb_thispack)*nx3*nx2*nx1;
+  const int nkji = nx3*nx2*nx1;
+  const int nji  = nx2*nx1;
+  int io = pgrav->ioff, jo = pgrav->joff, ko = pgrav->koff;
+  auto phi = pgrav->phi;
+  Real l1_err = 0.0, linfty_err = 0.0, vol_tot = 0.0;
+  Kokkos::parallel_reduce("poisson-err",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, Real &sum_err, Real &max_err, Real &sum_vol) {
+    // compute n,k,j,i indices of thread
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/nx1;
+    int i = (idx - m*nkji - k*nji - j*nx1) + is;
+    k += ks;
+    j += js;
+    Real x1v = CellCenterX(i-is, nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    Real x2v = CellCenterX(j-js, nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    Real x3v = CellCenterX(k-ks, nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+    Real prof = sin(k1*x1v);
+    if (multi_d) {prof *= sin(k2*x2v);}
+    if (three_d) {prof *= sin(k3*x3v);}
+    Real vol = size.d_view(m).dx1*size.d_view(m).dx2*size.d_view(m).dx3;
+    Real err = fabs(phi(m,0,k-ko,j-jo,i-io) - phi_amp*prof);
+    sum_err += vol*err;
+    max_err = fmax(max_err, err);
+    sum_vol += vol;
+  }, Kokkos::Sum<Real>(l1_err), Kokkos::Max<Real>(linfty_err),
+     Kokkos::Sum<Real>(vol_tot));
+
+#if MPI_PARALLEL_ENABLED
+  Real sums[2] = {l1_err, vol_tot};
+  MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &linfty_err, 1, MPI_ATHENA_REAL, MPI_MAX, MPI_COMM_WORLD);
+  l1_err = sums[0];
+  vol_tot = sums[1];
+#endif
+  l1_err /= vol_tot;
+
+  // root process opens output file and writes out errors
+  if (global_variable::my_rank == 0) {
+    std::cout << "L1 error = " << l1_err << ", L-infty error = " << linfty_err
+              << std::endl;
+    std::string fname;
+    fname.assign(pin->GetString("job","basename"));
+    fname.append("-errs.dat");
+    FILE *pfile;
+
+    // The file exists -- reopen the file in append mode
+    if ((pfile = std::fopen(fname.c_str(), "r")) != nullptr) {
+      if ((pfile = std::freopen(fname.c_str(), "a", pfile)) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Error output file could not be opened" <<std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+
+    // The file does not exist -- open the file in write mode and add headers
+    } else {
+      if ((pfile = std::fopen(fname.c_str(), "w")) == nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Error output file could not be opened" <<std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      std::fprintf(pfile, "# Nx1  Nx2  Nx3   Nmb  Niter  Conv-factor   Time/solve    ");
+      std::fprintf(pfile, "L1           L-infty\n");
+    }
+
+    // write errors
+    std::fprintf(pfile, "%04d", pmy_mesh_->mesh_indcs.nx1);
+    std::fprintf(pfile, "  %04d", pmy_mesh_->mesh_indcs.nx2);
+    std::fprintf(pfile, "  %04d", pmy_mesh_->mesh_indcs.nx3);
+    std::fprintf(pfile, "  %04d  %04d", pmy_mesh_->nmb_total, pmg->niterations);
+    std::fprintf(pfile, "  %e  %e  %e  %e\n", pmg->conv_factor, time_per_solve, l1_err,
+                 linfty_err);
+    std::fclose(pfile);
+  }
+  return;
+}
@@ -0,0 +1,191 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file task_list_bench.cpp
+//! \brief Microbenchmark of the overhead of the TaskList scheduler.  Builds 'nlist'
+//! TaskLists (e.g. one per MeshBlock) of 'ntask' tasks each, with a random dependency
+//! graph in which every 'recv_stride'-th task emulates a receive that returns
+//! TaskStatus::incomplete 'npoll' times before completing.  The task functions do no
+//! other work, so the measured time is the cost of the scheduler.  The lists are executed
+//! 'ncycle' times in the same way as Driver::ExecuteTaskList(), using both TaskList (with
+//! its ready queue) and a reference implementation that rescans the whole list in every
+//! call to DoAvailable(), as TaskList did before the ready queue was introduced.
+//!
+//! Compile with '-D PROBLEM=unit_tests/task_list_bench' and run with
+//! inputs/unit_tests/task_list_bench.athinput.
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "tasklist/task_list.hpp"
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \class ScanTaskList
+//! \brief reference scheduler that checks the dependencies of every task, and whether
+//! every task is complete, in each call to DoAvailable()
+
+class ScanTaskList {
+ public:
+  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep) {
+    TaskID id(tasks_.size()+1);
+    tasks_.push_back({id, dep, func, false});
+    return id;
+  }
+  void Reset() {
+    completed_.Clear();
+    for (auto &t : tasks_) {t.complete = false;}
+  }
+  bool IsComplete() {
+    for (auto &t : tasks_) {
+      if (!completed_.CheckDependencies(t.id)) return false;
+    }
+    return true;
+  }
+  TaskListStatus DoAvailable(Driver *d, int s) {
+    for (auto &t : tasks_) {
+      if (completed_.CheckDependencies(t.dep) && !t.complete) {
+        if (t.func(d,s) == TaskStatus::complete) {
+          t.complete = true;
+          completed_.SetComplete(t.id);
+        }
+      }
+    }
+    if (IsComplete()) return TaskListStatus::complete;
+    return TaskListStatus::running;
+  }
+
+ private:
+  struct ScanTask {
+    TaskID id, dep;
+    std::function<TaskStatus(Driver*, int)> func;
+    bool complete;
+  };
+  std::list<ScanTask> tasks_;
+  TaskID completed_;
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn double RunLists()
+//! \brief executes all lists ncycle times as in Driver::ExecuteTaskList(), cycling over
+//! the lists until all are complete.  Returns the elapsed time in seconds, and the total
+//! number of calls to DoAvailable() in nsweep.
+
+template <class TL>
+double RunLists(std::vector<std::unique_ptr<TL>> &lists, std::vector<int> &count,
+                int ncycle, std::int64_t &nsweep) {
+  int nlist = static_cast<int>(lists.size());
+  std::vector<bool> done(nlist);
+  nsweep = 0;
+  Kokkos::Timer timer;
+  for (int c=0; c<ncycle; ++c) {
+    std::fill(count.begin(), count.end(), 0);
+    for (auto &tl : lists) {tl->Reset();}
+    std::fill(done.begin(), done.end(), false);
+    int nleft = nlist;
+    while (nleft > 0) {
+      for (int l=0; l<nlist; ++l) {
+        if (!done[l] && !lists[l]->IsComplete()) {
+          nsweep++;
+          if (lists[l]->DoAvailable(nullptr, 1) == TaskListStatus::complete) {
+            done[l] = true;
+            nleft--;
+          }
+        }
+      }
+    }
+  }
+  return timer.seconds();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BuildLists()
+//! \brief adds the same random task graph to each list.  Each task depends on the
+//! previous task with probability 1/2, and on up to two other randomly chosen earlier
+//! tasks.  Task functions count their calls in 'count'.
+
+template <class TL>
+void BuildLists(std::vector<std::unique_ptr<TL>> &lists, std::vector<int> &count,
+                int nlist, int ntask, int npoll, int recv_stride) {
+  std::mt19937 gen(12345);
+  std::vector<std::vector<int>> deps(ntask);
+  for (int n=1; n<ntask; ++n) {
+    std::uniform_int_distribution<int> dist(0, n-1);
+    if (gen() % 2 == 0) {deps[n].push_back(n-1);}
+    int nextra = gen() % 3;
+    for (int e=0; e<nextra; ++e) {deps[n].push_back(dist(gen));}
+  }
+  count.assign(static_cast<std::size_t>(nlist)*ntask, 0);
+  int *pcount = count.data();
+  for (int l=0; l<nlist; ++l) {
+    lists.push_back(std::make_unique<TL>());
+    std::vector<TaskID> ids;
+    for (int n=0; n<ntask; ++n) {
+      TaskID dep(0);
+      for (int m : deps[n]) {dep = dep | ids[m];}
+      int *pc = pcount + static_cast<std::size_t>(l)*ntask + n;
+      int np = (n % recv_stride == recv_stride - 1) ? npoll : 0;
+      ids.push_back(lists[l]->AddTask(
+        [pc, np](Driver *d, int s) -> TaskStatus {
+          return ((*pc)++ < np) ? TaskStatus::incomplete : TaskStatus::complete;
+        }, dep));
+    }
+  }
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn ProblemGenerator::UserProblem()
+//! \brief runs the TaskList scheduler microbenchmark
+
+void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
+  int ntask = pin->GetOrAddInteger("problem", "ntask", 200);
+  int nlist = pin->GetOrAddInteger("problem", "nlist", 4000);
+  int ncycle = pin->GetOrAddInteger("problem", "ncycle", 5);
+  int npoll = pin->GetOrAddInteger("problem", "npoll", 2);
+  int recv_stride = pin->GetOrAddInteger("problem", "recv_stride", 8);
+  bool run_scan = pin->GetOrAddBoolean("problem", "run_scan", true);
+
+  std::int64_t ncall = static_cast<std::int64_t>(nlist)*ncycle*
+                       (ntask + npoll*(ntask/recv_stride));
+  std::vector<int> count;
+  std::int64_t nsweep;
+  std::cout << std::endl << "TaskList scheduler benchmark: " << nlist << " lists of "
+            << ntask << " tasks, " << ncycle << " cycles, " << ncall
+            << " task calls" << std::endl;
+  std::cout << std::left << std::setw(24) << "scheduler" << std::right
+            << std::setw(14) << "time [s]" << std::setw(14) << "sweeps"
+            << std::setw(16) << "ns/task call" << std::endl;
+
+  double tq, ts = 0.0;
+  {
+    std::vector<std::unique_ptr<TaskList>> lists;
+    BuildLists(lists, count, nlist, ntask, npoll, recv_stride);
+    tq = RunLists(lists, count, ncycle, nsweep);
+    std::cout << std::left << std::setw(24) << "ready queue" << std::right
+              << std::setw(14) << tq << std::setw(14) << nsweep << std::setw(16)
+              << 1.0e9*tq/ncall << std::endl;
+  }
+  if (run_scan) {
+    std::vector<std::unique_ptr<ScanTaskList>> lists;
+    BuildLists(lists, count, nlist, ntask, npoll, recv_stride);
+    ts = RunLists(lists, count, ncycle, nsweep);
+    std::cout << std::left << std::setw(24) << "rescan (reference)" << std::right
+              << std::setw(14) << ts << std::setw(14) << nsweep << std::setw(16)
+              << 1.0e9*ts/ncall << std::endl;
+    std::cout << "speed-up of ready queue = " << ts/tq << std::endl;
+  }
+  return;
+}
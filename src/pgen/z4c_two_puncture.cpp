@@ -11,6 +11,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "TwoPunctures.h"
 #include "coordinates/adm.hpp"
@@ -21,6 +22,7 @@
 #include "parameter_input.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
+#include "utils/id_cache.hpp"
 
 static ini_data *data;
 
@@ -168,8 +170,19 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   TwoPunctures_params_set_Boolean(
     const_cast<char *>("swap_xz"),
     pin->GetOrAddBoolean(set_name, "swap_xz", 0));
-  data = TwoPunctures_make_initial_data();
-  ADMTwoPunctures(pmbp, data);
+
+  // ADM variables are read from the initial data cache if it is enabled
+  // (<problem>/id_cache_dir) and contains a snapshot for these parameters and mesh,
+  // otherwise the TwoPunctures solution is computed and interpolated.
+  InitialDataCache id_cache(pin, pmy_mesh_, "", {});
+  std::vector<DvceArray5D<Real>> id_vars = {pmbp->padm->u_adm};
+  std::vector<Real> id_scalars;
+  if (!id_cache.Load(id_vars, id_scalars)) {
+    data = TwoPunctures_make_initial_data();
+    ADMTwoPunctures(pmbp, data);
+    TwoPunctures_finalise(data);
+    id_cache.Save(id_vars, id_scalars);
+  }
   pmbp->pz4c->GaugePreCollapsedLapse(pmbp, pin);
   switch (indcs.ng) {
     case 2:
@@ -182,7 +195,6 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
       pmbp->pz4c->ADMToZ4c<4>(pmbp, pin);
       break;
   }
-  TwoPunctures_finalise(data);
 
   pmbp->pz4c->Z4cToADM(pmbp);
   switch (indcs.ng) {
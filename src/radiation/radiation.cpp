@@ -127,6 +127,14 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   if (is_hydro_enabled || is_mhd_enabled) {
     Kokkos::realloc(norm_to_tet,nmb,4,4,ncells3,ncells2,ncells1);
   }
+  auto &pool = ppack->pmesh->pmb_pool;
+  pool->Register(tet_c);
+  pool->Register(tetcov_c);
+  pool->Register(tet_d1_x1f);
+  pool->Register(tet_d2_x2f);
+  pool->Register(tet_d3_x3f);
+  if (angular_fluxes) {pool->Register(na);}
+  if (is_hydro_enabled || is_mhd_enabled) {pool->Register(norm_to_tet);}
   }
   SetOrthonormalTetrad();
 
@@ -140,6 +148,7 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
   int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
   Kokkos::realloc(i0,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+  ppack->pmesh->pmb_pool->Register(i0);
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -149,6 +158,7 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     int nccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int nccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_i0,nmb,prgeo->nangles,nccells3,nccells2,nccells1);
+    ppack->pmesh->pmb_pool->Register(coarse_i0);
   }
 
   // allocate boundary buffers for conserved (cell-centered) variables
@@ -196,8 +206,11 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     Kokkos::realloc(iflx.x1f,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
     Kokkos::realloc(iflx.x2f,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
     Kokkos::realloc(iflx.x3f,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+    ppack->pmesh->pmb_pool->Register(i1);
+    ppack->pmesh->pmb_pool->Register(iflx);
     if (angular_fluxes) {
       Kokkos::realloc(divfa,nmb,prgeo->nangles,ncells3,ncells2,ncells1);
+      ppack->pmesh->pmb_pool->Register(divfa);
     }
   }
 }
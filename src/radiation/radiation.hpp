@@ -6,7 +6,8 @@
 // Licensed under the 3-clause BSD License (the "LICENSE")
 //========================================================================================
 //! \file radiation.hpp
-//  \brief definitions for Radiation class
+//  \brief definitions for Radiation class.  The intensities, fluxes, and tetrads are stored
+//  as RadReal, which is float when compiled with Athena_RADIATION_MIXED_PRECISION=ON.
 
 #include <map>
 #include <memory>
@@ -117,26 +118,26 @@ class Radiation {
   // Tetrad arrays and functions
   DualArray2D<Real> nh_c;             // normal vector computed at face center
   DualArray3D<Real> nh_f;             // normal vector computed at face edges
-  DvceArray6D<Real> tet_c;            // tetrad components at cell centers
-  DvceArray6D<Real> tetcov_c;         // covariant tetrad components at cell centers
-  DvceArray5D<Real> tet_d1_x1f;       // tetrad components (subset) at x1f
-  DvceArray5D<Real> tet_d2_x2f;       // tetrad components (subset) at x2f
-  DvceArray5D<Real> tet_d3_x3f;       // tetrad components (subset) at x3f
-  DvceArray6D<Real> na;               // n^a
-  DvceArray6D<Real> norm_to_tet;      // used in transform b/w normal frame and tet frame
+  DvceArray6D<RadReal> tet_c;         // tetrad components at cell centers
+  DvceArray6D<RadReal> tetcov_c;      // covariant tetrad components at cell centers
+  DvceArray5D<RadReal> tet_d1_x1f;    // tetrad components (subset) at x1f
+  DvceArray5D<RadReal> tet_d2_x2f;    // tetrad components (subset) at x2f
+  DvceArray5D<RadReal> tet_d3_x3f;    // tetrad components (subset) at x3f
+  DvceArray6D<RadReal> na;            // n^a
+  DvceArray6D<RadReal> norm_to_tet;   // used in transform b/w normal and tet frames
   void SetOrthonormalTetrad();
 
   // intensity arrays
-  DvceArray5D<Real> i0;         // intensities
-  DvceArray5D<Real> coarse_i0;  // intensities on 2x coarser grid (for SMR/AMR)
+  DvceArray5D<RadReal> i0;         // intensities
+  DvceArray5D<RadReal> coarse_i0;  // intensities on 2x coarser grid (for SMR/AMR)
 
   // Boundary communication buffers and functions for i
   MeshBoundaryValuesCC *pbval_i;
 
   // following only used for time-evolving flow
-  DvceArray5D<Real> i1;         // intensity at intermediate step
-  DvceFaceFld5D<Real> iflx;     // spatial fluxes on zone faces
-  DvceArray5D<Real> divfa;      // angular flux divergence
+  DvceArray5D<RadReal> i1;         // intensity at intermediate step
+  DvceFaceFld5D<RadReal> iflx;     // spatial fluxes on zone faces
+  DvceArray5D<RadReal> divfa;      // angular flux divergence
   Real dtnew;
 
   // reconstruction method
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <utility>
 
 #include "athena.hpp"
@@ -30,7 +31,13 @@
 OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
     maxjshift(1),
     shearing_box_r_phi(false),     // 2D r-phi not yet implemented
-    pmy_pack(ppack) {
+    spectral_remap(false),
+    pmy_pack(ppack),
+    nrbx2(1),
+    nline(0),
+    nline_max(0),
+    nxtra(0),
+    spec_stage(0) {
   // Read shear rate and orbital frequency
   qshear = pin->GetReal("shearing_box","qshear");
   omega0 = pin->GetReal("shearing_box","omega0");
@@ -40,6 +47,30 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
   Real xmax = fabs(ppack->pmesh->mesh_size.x1max);
   maxjshift = static_cast<int>((ppack->pmesh->cfl_no)*std::max(xmin,xmax)) + 1;
 
+  // select method used to apply shift: conservative remap ("flux", default) within each
+  // MeshBlock, or phase shift of x2-pencils spanning entire mesh ("spectral")
+  std::string remap = pin->GetOrAddString("shearing_box","orbital_remap","flux");
+  if (remap.compare("spectral") == 0) {
+    spectral_remap = true;
+    auto *pm = ppack->pmesh;
+    int nx2 = pm->mesh_indcs.nx2;
+    if (pm->multilevel ||
+        pm->mesh_bcs[BoundaryFace::inner_x2] != BoundaryFlag::periodic ||
+        pm->mesh_bcs[BoundaryFace::outer_x2] != BoundaryFlag::periodic ||
+        (nx2 & (nx2 - 1)) != 0) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "<shearing_box>/orbital_remap=spectral requires a "
+                << "uniform mesh, periodic boundaries in x2, and a power of two cells in "
+                << "x2" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  } else if (remap.compare("flux") != 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<shearing_box>/orbital_remap=" << remap << " not "
+              << "implemented, must be 'flux' or 'spectral'" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
 #if MPI_PARALLEL_ENABLED
   // For orbital advection, communication is only with x2-face neighbors
   // initialize vectors of MPI request in 2 elements of fixed length arrays
@@ -8,6 +8,14 @@
 //! \file orbital_advection.hpp
 //! \brief definitions for classes that implement orbital advection abstract base and
 //! derived classes (for CC and FC variables).
+//!
+//! By default the shift in x2 is computed by each MeshBlock as an integer shift plus a
+//! conservative remap of the fractional offset, using maxjshift-wide buffers exchanged
+//! with its two x2-neighbors.  With <shearing_box>/orbital_remap=spectral (uniform mesh,
+//! periodic in x2) the data is instead transposed into x2-pencils spanning the whole
+//! mesh, and the full shift is applied as a phase rotation of the Fourier modes.
+
+#include <vector>
 
 #include "athena.hpp"
 #include "parameter_input.hpp"
@@ -27,6 +35,7 @@ class OrbitalAdvection {
   int maxjshift;            // maximum integer shift of any cell in orbital advection
   Real qshear, omega0;      // Copies needed for all OA functions
   bool shearing_box_r_phi;  // NOT YET IMPLEMENTED
+  bool spectral_remap;      // true to apply shift with FFT on x2-pencils
 
   // data buffers for orbital advection. Only two x2-faces communicate
   ShearingBoxBoundaryBuffer sendbuf[2], recvbuf[2];
@@ -45,6 +54,33 @@ class OrbitalAdvection {
   // must use pointer to MBPack and not parent physics module since parent can be one of
   // many types (Hydro, MHD, Radiation, etc.)
   MeshBlockPack *pmy_pack;
+
+  // data for spectral remap.  Each MeshBlock in a column of nrbx2 MeshBlocks along x2
+  // owns a contiguous subset of the nline x2-lines of the column, which it stores over
+  // the full length of the mesh in x2 in the pencil array after the transpose.
+  int nrbx2;                       // number of MeshBlocks in x2 (length of column)
+  int nline;                       // number of x2-lines in each MeshBlock
+  int nline_max;                   // maximum number of lines owned by any MeshBlock
+  int nxtra;                       // number of extra points returned (1 for EMFs)
+  int spec_stage;                  // 0: waiting for transpose, 1: transpose back
+  DualArray1D<int> spec_lx2;       // x2-logical location of each MeshBlock
+  // tables of (MB index, MB location in column, offset in lines) of each data chunk
+  DualArray2D<int> fwd_send, fwd_recv, bck_send, bck_recv;
+  // number of values sent to/recv from each rank, and their offset in the buffers
+  std::vector<int> fwd_scnt, fwd_sdsp, fwd_rcnt, fwd_rdsp;
+  std::vector<int> bck_scnt, bck_sdsp, bck_rcnt, bck_rdsp;
+  DvceArray1D<Real> spec_sbuf, spec_rbuf;  // send/recv buffers for transpose
+  DvceArray3D<Real> pencil;                // (nmb,nline_max,nx2 of mesh) pencils
+  DvceArray2D<Real> twiddle;               // twiddle factors for FFT
+#if MPI_PARALLEL_ENABLED
+  MPI_Request spec_req;
+#endif
+  void InitSpectralRemap(int nline, int nxtra);
+  void StartTranspose(bool forward);
+  bool TestTranspose();
+  void UnpackToPencils();
+  void ShiftPencils(bool compute_flux);
+  void PackFromPencils();
 };
 
 //----------------------------------------------------------------------------------------
@@ -57,6 +93,10 @@ class OrbitalAdvectionCC : public OrbitalAdvection {
   // functions to communicate CC data with orbital advection
   TaskStatus PackAndSendCC(DvceArray5D<Real> &a);
   TaskStatus RecvAndUnpackCC(DvceArray5D<Real> &a, ReconstructionMethod rcon);
+
+ private:
+  TaskStatus PackAndSendCC_Spectral(DvceArray5D<Real> &a);
+  TaskStatus RecvAndUnpackCC_Spectral(DvceArray5D<Real> &a);
 };
 
 //----------------------------------------------------------------------------------------
@@ -73,6 +113,11 @@ class OrbitalAdvectionFC : public OrbitalAdvection {
   // functions to communicate FC data with orbital advection
   TaskStatus PackAndSendFC(DvceFaceFld4D<Real> &b);
   TaskStatus RecvAndUnpackFC(DvceFaceFld4D<Real> &b0, ReconstructionMethod rcon);
+
+ private:
+  TaskStatus PackAndSendFC_Spectral(DvceFaceFld4D<Real> &b);
+  TaskStatus RecvAndUnpackFC_Spectral(DvceFaceFld4D<Real> &b0);
+  void UpdateFieldsCT(DvceFaceFld4D<Real> &b0);
 };
 
 #endif // SHEARING_BOX_ORBITAL_ADVECTION_HPP_
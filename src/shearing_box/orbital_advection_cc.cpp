@@ -29,9 +29,14 @@
 
 OrbitalAdvectionCC::OrbitalAdvectionCC(MeshBlockPack *pp, ParameterInput *pin, int nv) :
     OrbitalAdvection(pp, pin) {
+  auto &indcs = pp->pmesh->mb_indcs;
+  // spectral remap does not use boundary buffers
+  if (spectral_remap) {
+    InitSpectralRemap(nv*(indcs.nx3)*(indcs.nx1), 0);
+    return;
+  }
   // Initialize boundary buffers
   int nmb = std::max((pp->nmb_thispack), (pp->pmesh->nmb_maxperrank));
-  auto &indcs = pp->pmesh->mb_indcs;
   int ncells3 = indcs.nx3;
   int ncells2 = indcs.ng + maxjshift;
   int ncells1 = indcs.nx1;
@@ -51,6 +56,8 @@ OrbitalAdvectionCC::OrbitalAdvectionCC(MeshBlockPack *pp, ParameterInput *pin, i
 //! Input arrays must be 5D Kokkos View dimensioned (nmb, nvar, nx3, nx2, nx1)
 
 TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
+  if (spectral_remap) {return PackAndSendCC_Spectral(a);}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   int nvar = a.extent_int(1);  // TODO(@user): 2nd index from L of in array must be NVAR
@@ -175,6 +182,8 @@ TaskStatus OrbitalAdvectionCC::PackAndSendCC(DvceArray5D<Real> &a) {
 
 TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC(DvceArray5D<Real> &a,
                                                ReconstructionMethod rcon) {
+  if (spectral_remap) {return RecvAndUnpackCC_Spectral(a);}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
   auto &rbuf = recvbuf;
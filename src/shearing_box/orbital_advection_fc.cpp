@@ -29,15 +29,19 @@
 
 OrbitalAdvectionFC::OrbitalAdvectionFC(MeshBlockPack *pp, ParameterInput *pin) :
   OrbitalAdvection(pp, pin) {
-  // Initialize boundary buffers
+  // Initialize boundary buffers (not used with spectral remap)
   int nmb = std::max((pp->nmb_thispack), (pp->pmesh->nmb_maxperrank));
   auto &indcs = pp->pmesh->mb_indcs;
   int ncells3 = indcs.nx3 + 1;
   int ncells2 = indcs.ng + maxjshift;
   int ncells1 = indcs.nx1 + 1;
-  for (int n=0; n<2; ++n) {
-    Kokkos::realloc(sendbuf[n].vars,nmb,2,ncells3,ncells2,ncells1);
-    Kokkos::realloc(recvbuf[n].vars,nmb,2,ncells3,ncells2,ncells1);
+  if (spectral_remap) {
+    InitSpectralRemap(2*ncells3*ncells1, 1);
+  } else {
+    for (int n=0; n<2; ++n) {
+      Kokkos::realloc(sendbuf[n].vars,nmb,2,ncells3,ncells2,ncells1);
+      Kokkos::realloc(recvbuf[n].vars,nmb,2,ncells3,ncells2,ncells1);
+    }
   }
 
   // Allocate memory for electric fields
@@ -56,6 +60,8 @@ OrbitalAdvectionFC::OrbitalAdvectionFC(MeshBlockPack *pp, ParameterInput *pin) :
 //! Note only B3 and B1 need be passed.
 
 TaskStatus OrbitalAdvectionFC::PackAndSendFC(DvceFaceFld4D<Real> &b) {
+  if (spectral_remap) {return PackAndSendFC_Spectral(b);}
+
   // create local references for variables in kernel
   int nmb = pmy_pack->nmb_thispack;
 
@@ -182,6 +188,8 @@ TaskStatus OrbitalAdvectionFC::PackAndSendFC(DvceFaceFld4D<Real> &b) {
 
 TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
                                              ReconstructionMethod rcon) {
+  if (spectral_remap) {return RecvAndUnpackFC_Spectral(b0);}
+
   int nmb = pmy_pack->nmb_thispack;
   auto &rbuf = recvbuf;
 #if MPI_PARALLEL_ENABLED
@@ -330,6 +338,26 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
   });
 
   // Update face-centered fields using CT
+  UpdateFieldsCT(b0);
+
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvectionFC::UpdateFieldsCT()
+//! \brief Updates face-centered fields with CT using effective EMFs computed in the
+//! orbital advection step
+
+void OrbitalAdvectionFC::UpdateFieldsCT(DvceFaceFld4D<Real> &b0) {
+  int nmb = pmy_pack->nmb_thispack;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  auto &is = indcs.is, &ie = indcs.ie;
+  auto &js = indcs.js, &je = indcs.je;
+  auto &ks = indcs.ks, &ke = indcs.ke;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &emfx_ = emfx;
+  auto &emfz_ = emfz;
+
   //---- update B1 (only for 2D/3D problems)
   if (pmy_pack->pmesh->multi_d) {
     par_for("oaCT-b1", DevExeSpace(), 0, nmb-1, ks, ke, js, je, is, ie+1,
@@ -358,5 +386,5 @@ TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b0,
     });
   }
 
-  return TaskStatus::complete;
+  return;
 }
@@ -0,0 +1,571 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics & numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file orbital_advection_spectral.cpp
+//! \brief functions implementing the spectral remap used in orbital advection with
+//! <shearing_box>/orbital_remap=spectral.
+//!
+//! The x2-lines of each column of MeshBlocks (all MeshBlocks with the same x1- and
+//! x3-logical locations) are divided among the MeshBlocks in the column, and transposed
+//! (with one MPI_Ialltoallv for all MeshBlocks) so that each MeshBlock holds its lines
+//! over the full length of the mesh in x2.  Each line is then shifted by multiplying its
+//! Fourier modes by exp(-i k yshear), and transposed back.  Since x2 is periodic the
+//! shift is exact for cell averages, conserves the sum over each line to round-off, and
+//! is not limited to maxjshift cells.  For face-centered fields the effective EMFs (the
+//! "fluxes" through each x2-face during the shift) are computed spectrally instead, and
+//! the fields are updated with CT to preserve div(B).
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "mesh/mesh.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "shearing_box.hpp"
+#include "orbital_advection.hpp"
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \struct SpectralChunk
+//! \brief lines of one MeshBlock sent to/received from another MeshBlock in its column
+
+struct SpectralChunk {
+  int rank;      // rank of other MeshBlock
+  int dst, src;  // GIDs of MeshBlocks receiving/sending data
+  int m;         // index of MeshBlock on this rank in MeshBlockPack
+  int jb;        // x2-logical location of other MeshBlock
+  int nl;        // number of lines
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn SetChunkTable()
+//! \brief Sorts chunks by (rank, destination GID, source GID), which gives the same order
+//! on the sending and receiving ranks, and stores table of (m, jb, offset, nl) for each
+//! chunk together with the number of values and offsets for each rank used by MPI.
+
+void SetChunkTable(std::vector<SpectralChunk> &chunks, const int seg, const int nranks,
+                   DualArray2D<int> &tab, std::vector<int> &cnt, std::vector<int> &dsp) {
+  std::sort(chunks.begin(), chunks.end(),
+            [](const SpectralChunk &a, const SpectralChunk &b) {
+    if (a.rank != b.rank) return a.rank < b.rank;
+    if (a.dst != b.dst) return a.dst < b.dst;
+    return a.src < b.src;
+  });
+  int nc = chunks.size();
+  Kokkos::realloc(tab, std::max(nc, 1), 4);
+  cnt.assign(nranks, 0);
+  dsp.assign(nranks, 0);
+  int off = 0;
+  for (int c=0; c<nc; ++c) {
+    tab.h_view(c,0) = chunks[c].m;
+    tab.h_view(c,1) = chunks[c].jb;
+    tab.h_view(c,2) = off;
+    tab.h_view(c,3) = chunks[c].nl;
+    cnt[chunks[c].rank] += seg*chunks[c].nl;
+    off += chunks[c].nl;
+  }
+  for (int r=1; r<nranks; ++r) {
+    dsp[r] = dsp[r-1] + cnt[r-1];
+  }
+  tab.template modify<HostMemSpace>();
+  tab.template sync<DevExeSpace>();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn BitReverse()
+//! \brief reverses order of the lowest nlog bits of j
+
+KOKKOS_INLINE_FUNCTION
+int BitReverse(int j, const int nlog) {
+  int r = 0;
+  for (int b=0; b<nlog; ++b) {
+    r = (r << 1) | (j & 1);
+    j >>= 1;
+  }
+  return r;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn FFT_Radix2()
+//! \brief in-place radix-2 FFT of length n (power of 2) of data stored in bit-reversed
+//! order in scratch arrays. Butterflies at each level are computed in parallel by team.
+//! Twiddle factors exp(-2 pi i q/n) for q<n/2 are stored in tw(q,0:1).
+
+KOKKOS_INLINE_FUNCTION
+void FFT_Radix2(TeamMember_t const &member, const int n, const Real sign,
+                const DvceArray2D<Real> &tw,
+                const ScrArray1D<Real> &re, const ScrArray1D<Real> &im) {
+  for (int len=2; len<=n; len <<= 1) {
+    int half = len/2;
+    int stride = n/len;
+    par_for_inner(member, 0, (n/2-1), [&](const int b) {
+      int pos = b % half;
+      int i0 = (b/half)*len + pos;
+      int i1 = i0 + half;
+      Real wr = tw(pos*stride,0), wi = sign*tw(pos*stride,1);
+      Real tr = wr*re(i1) - wi*im(i1);
+      Real ti = wr*im(i1) + wi*re(i1);
+      re(i1) = re(i0) - tr;
+      im(i1) = im(i0) - ti;
+      re(i0) += tr;
+      im(i0) += ti;
+    });
+    member.team_barrier();
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn SpectralFactor()
+//! \brief factor multiplying mode q (0<=q<=n/2) of a line shifted by s cells.  Equals
+//! exp(-i kap s) with kap=2 pi q/n for the data, or (1-exp(-i kap s))/(1-exp(-i kap))
+//! for the flux through cell faces during the shift.  Only the real part is kept at the
+//! Nyquist frequency so that the result is real.
+
+KOKKOS_INLINE_FUNCTION
+void SpectralFactor(const int q, const int n, const Real s, const bool flux,
+                    Real &fr, Real &fi) {
+  Real kap = 2.0*M_PI*static_cast<Real>(q)/static_cast<Real>(n);
+  Real th = -kap*s;
+  if (!(flux)) {
+    fr = cos(th);
+    fi = (2*q == n)? 0.0 : sin(th);
+  } else if (q == 0) {
+    fr = s;
+    fi = 0.0;
+  } else if (2*q == n) {
+    fr = 0.5*(1.0 - cos(th));
+    fi = 0.0;
+  } else {
+    Real nr = 1.0 - cos(th), ni = -sin(th);
+    Real dr = 1.0 - cos(kap), di = sin(kap);
+    Real d2 = dr*dr + di*di;
+    fr = (nr*dr + ni*di)/d2;
+    fi = (ni*dr - nr*di)/d2;
+  }
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::InitSpectralRemap()
+//! \brief Sets up tables and buffers used to transpose nl lines of each MeshBlock into
+//! x2-pencils.  The back transpose returns nx2+nx values per line, where nx=1 for EMFs.
+
+void OrbitalAdvection::InitSpectralRemap(int nl, int nx) {
+  auto *pm = pmy_pack->pmesh;
+  int nmb = pmy_pack->nmb_thispack;
+  int nx2 = pm->mb_indcs.nx2;
+  int nrbx1 = pm->nmb_rootx1;
+  int nrbx3 = pm->nmb_rootx3;
+  nrbx2 = pm->nmb_rootx2;
+  nline = nl;
+  nxtra = nx;
+  nline_max = (nline + nrbx2 - 1)/nrbx2;
+
+  // GID of MeshBlock at each logical location (mesh is uniform)
+  std::vector<int> gid_at(nrbx1*nrbx2*nrbx3, -1);
+  for (int g=0; g<pm->nmb_total; ++g) {
+    auto &lloc = pm->lloc_eachmb[g];
+    gid_at[(lloc.lx3*nrbx2 + lloc.lx2)*nrbx1 + lloc.lx1] = g;
+  }
+
+  // Build list of chunks sent/received by each MeshBlock in forward/back transposes
+  int nrb = nrbx2;
+  auto nlines = [nl, nrb](int jb) {return ((jb+1)*nl)/nrb - (jb*nl)/nrb;};
+  std::vector<SpectralChunk> fs, fr, bs, br;
+  Kokkos::realloc(spec_lx2, std::max(nmb, 1));
+  for (int m=0; m<nmb; ++m) {
+    int gid = pmy_pack->gids + m;
+    auto &lloc = pm->lloc_eachmb[gid];
+    spec_lx2.h_view(m) = lloc.lx2;
+    for (int jb=0; jb<nrbx2; ++jb) {
+      int g = gid_at[(lloc.lx3*nrbx2 + jb)*nrbx1 + lloc.lx1];
+      int r = pm->rank_eachmb[g];
+      fs.push_back({r, g, gid, m, jb, nlines(jb)});
+      fr.push_back({r, gid, g, m, jb, nlines(lloc.lx2)});
+      bs.push_back({r, g, gid, m, jb, nlines(lloc.lx2)});
+      br.push_back({r, gid, g, m, jb, nlines(jb)});
+    }
+  }
+  spec_lx2.template modify<HostMemSpace>();
+  spec_lx2.template sync<DevExeSpace>();
+
+  int nranks = global_variable::nranks;
+  SetChunkTable(fs, nx2, nranks, fwd_send, fwd_scnt, fwd_sdsp);
+  SetChunkTable(fr, nx2, nranks, fwd_recv, fwd_rcnt, fwd_rdsp);
+  SetChunkTable(bs, nx2+nxtra, nranks, bck_send, bck_scnt, bck_sdsp);
+  SetChunkTable(br, nx2+nxtra, nranks, bck_recv, bck_rcnt, bck_rdsp);
+
+  // buffers sized for largest transpose
+  int nbuf = 1;
+  for (auto *v : {&fwd_scnt, &fwd_rcnt, &bck_scnt, &bck_rcnt}) {
+    int ntot = 0;
+    for (int r=0; r<nranks; ++r) {ntot += (*v)[r];}
+    nbuf = std::max(nbuf, ntot);
+  }
+  Kokkos::realloc(spec_sbuf, nbuf);
+  Kokkos::realloc(spec_rbuf, nbuf);
+  Kokkos::realloc(pencil, std::max(nmb, 1), std::max(nline_max, 1), nrbx2*nx2);
+
+  // twiddle factors used in FFTs of length nrbx2*nx2
+  int ny = nrbx2*nx2;
+  Kokkos::realloc(twiddle, std::max(ny/2, 1), 2);
+  auto tw = Kokkos::create_mirror_view(twiddle);
+  for (int q=0; q<ny/2; ++q) {
+    tw(q,0) = std::cos(2.0*M_PI*static_cast<Real>(q)/static_cast<Real>(ny));
+    tw(q,1) = -std::sin(2.0*M_PI*static_cast<Real>(q)/static_cast<Real>(ny));
+  }
+  Kokkos::deep_copy(twiddle, tw);
+#if MPI_PARALLEL_ENABLED
+  spec_req = MPI_REQUEST_NULL;
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::StartTranspose()
+//! \brief Starts forward (MeshBlocks to pencils) or back (pencils to MeshBlocks)
+//! transpose of data already packed into send buffer.  With MPI all chunks sent between
+//! two ranks are aggregated into a single message.
+
+void OrbitalAdvection::StartTranspose(bool forward) {
+#if MPI_PARALLEL_ENABLED
+  Kokkos::fence();
+  auto &scnt = (forward)? fwd_scnt : bck_scnt;
+  auto &sdsp = (forward)? fwd_sdsp : bck_sdsp;
+  auto &rcnt = (forward)? fwd_rcnt : bck_rcnt;
+  auto &rdsp = (forward)? fwd_rdsp : bck_rdsp;
+  int ierr = MPI_Ialltoallv(spec_sbuf.data(), scnt.data(), sdsp.data(), MPI_ATHENA_REAL,
+                            spec_rbuf.data(), rcnt.data(), rdsp.data(), MPI_ATHENA_REAL,
+                            comm_orb_advect, &spec_req);
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in posting transpose" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+#else
+  // chunks are stored in the same order in send and recv buffers on a single rank
+  Kokkos::deep_copy(DevExeSpace(), spec_rbuf, spec_sbuf);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool OrbitalAdvection::TestTranspose()
+//! \brief Returns true if transpose started by StartTranspose() has completed
+
+bool OrbitalAdvection::TestTranspose() {
+#if MPI_PARALLEL_ENABLED
+  int test;
+  int ierr = MPI_Test(&spec_req, &test, MPI_STATUS_IGNORE);
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in testing transpose" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return static_cast<bool>(test);
+#else
+  return true;
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::UnpackToPencils()
+//! \brief Copies segments of length nx2 received in forward transpose into pencils
+
+void OrbitalAdvection::UnpackToPencils() {
+  int nx2 = pmy_pack->pmesh->mb_indcs.nx2;
+  int nc = nrbx2*(pmy_pack->nmb_thispack);
+  auto &tab = fwd_recv;
+  auto &rbuf = spec_rbuf;
+  auto &pen = pencil;
+  par_for("oa-unpk-pen", DevExeSpace(), 0, (nc-1), 0, (nline_max-1), 0, (nx2-1),
+  KOKKOS_LAMBDA(int c, int l, int j) {
+    if (l < tab.d_view(c,3)) {
+      pen(tab.d_view(c,0), l, tab.d_view(c,1)*nx2 + j) =
+          rbuf((tab.d_view(c,2)+l)*nx2 + j);
+    }
+  });
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::PackFromPencils()
+//! \brief Copies segments of length nx2+nxtra of pencils into send buffer for back
+//! transpose.  Extra value(s) are taken from the next segment (periodic in x2).
+
+void OrbitalAdvection::PackFromPencils() {
+  int nx2 = pmy_pack->pmesh->mb_indcs.nx2;
+  int ny = nrbx2*nx2;
+  int seg = nx2 + nxtra;
+  int nc = nrbx2*(pmy_pack->nmb_thispack);
+  auto &tab = bck_send;
+  auto &sbuf = spec_sbuf;
+  auto &pen = pencil;
+  par_for("oa-pack-pen", DevExeSpace(), 0, (nc-1), 0, (nline_max-1), 0, (seg-1),
+  KOKKOS_LAMBDA(int c, int l, int j) {
+    if (l < tab.d_view(c,3)) {
+      sbuf((tab.d_view(c,2)+l)*seg + j) = pen(tab.d_view(c,0), l,
+                                              (tab.d_view(c,1)*nx2 + j) % ny);
+    }
+  });
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::ShiftPencils()
+//! \brief Shifts each pencil by yshear = -q*Omega*x1*dt using FFT.  The Fourier modes
+//! are multiplied by exp(-i k yshear) for CC variables.  If compute_flux=true, the data
+//! are face-centered fields and the pencil is replaced by the "flux" through the lower
+//! x2-face of each cell during the shift, which is used as the effective EMF.
+//! Since the data are real, two pencils are transformed at once as the real and
+//! imaginary parts of one complex FFT.
+
+void OrbitalAdvection::ShiftPencils(bool compute_flux) {
+  int nmb = pmy_pack->nmb_thispack;
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int nx1 = indcs.nx1, nx3 = indcs.nx3;
+  int ny = nrbx2*indcs.nx2;
+  int nlog = 0;
+  while ((1 << nlog) < ny) {nlog++;}
+  int nl = nline, nrb = nrbx2;
+  int npair = (nline_max + 1)/2;
+  auto &lx2 = spec_lx2;
+  auto &pen = pencil;
+  auto &tw = twiddle;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  Real dt = pmy_pack->pmesh->dt;
+  Real qo = qshear*omega0;
+
+  int scr_lvl=0;
+  size_t scr_size = ScrArray1D<Real>::shmem_size(ny) * 2;
+  par_for_outer("oa-fft",DevExeSpace(),scr_size,scr_lvl,0,(nmb-1),0,(npair-1),
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int p) {
+    // lines owned by this MB have contiguous indices [lo,lo+nown) in column
+    int jb = lx2.d_view(m);
+    int lo = (jb*nl)/nrb;
+    int nown = ((jb+1)*nl)/nrb - lo;
+    int l0 = 2*p, l1 = 2*p + 1;
+    if (l0 >= nown) return;
+    bool two = (l1 < nown);
+
+    // shift of line in units of cells.  Lines of B1 (second field) are at x1-faces
+    Real &x1min = mbsize.d_view(m).x1min;
+    Real &x1max = mbsize.d_view(m).x1max;
+    auto shift = [&](const int gl) {
+      Real x1;
+      if (compute_flux) {
+        int i = gl % (nx1+1);
+        if (gl/((nx3+1)*(nx1+1)) == 1) {
+          x1 = LeftEdgeX(i, nx1, x1min, x1max);
+        } else {
+          x1 = CellCenterX(i, nx1, x1min, x1max);
+        }
+      } else {
+        x1 = CellCenterX(gl % nx1, nx1, x1min, x1max);
+      }
+      return -(qo)*x1*dt/(mbsize.d_view(m).dx2);
+    };
+    Real s0 = shift(lo + l0);
+    Real s1 = (two)? shift(lo + l1) : 0.0;
+
+    ScrArray1D<Real> re(member.team_scratch(scr_lvl), ny);
+    ScrArray1D<Real> im(member.team_scratch(scr_lvl), ny);
+
+    // forward transform
+    par_for_inner(member, 0, (ny-1), [&](const int j) {
+      int jr = BitReverse(j, nlog);
+      re(jr) = pen(m,l0,j);
+      im(jr) = (two)? pen(m,l1,j) : 0.0;
+    });
+    member.team_barrier();
+    FFT_Radix2(member, ny, 1.0, tw, re, im);
+
+    // separate transforms of two lines, multiply each mode by phase shift (or transfer
+    // function of flux), and recombine.  Modes q and ny-q are handled together.
+    par_for_inner(member, 0, (ny/2), [&](const int q) {
+      int qn = (ny - q) % ny;
+      Real ar = 0.5*(re(q) + re(qn)), ai = 0.5*(im(q) - im(qn));
+      Real br = 0.5*(im(q) + im(qn)), bi = -0.5*(re(q) - re(qn));
+      Real fr, fi;
+      SpectralFactor(q, ny, s0, compute_flux, fr, fi);
+      Real tr = ar*fr - ai*fi;
+      ai = ar*fi + ai*fr;
+      ar = tr;
+      SpectralFactor(q, ny, s1, compute_flux, fr, fi);
+      tr = br*fr - bi*fi;
+      bi = br*fi + bi*fr;
+      br = tr;
+      re(q) = ar - bi;
+      im(q) = ai + br;
+      if (qn != q) {
+        re(qn) = ar + bi;
+        im(qn) = br - ai;
+      }
+    });
+    member.team_barrier();
+
+    // inverse transform (bit-reverse in place, pairs are disjoint)
+    par_for_inner(member, 0, (ny-1), [&](const int j) {
+      int jr = BitReverse(j, nlog);
+      if (j < jr) {
+        Real tr = re(j), ti = im(j);
+        re(j) = re(jr); im(j) = im(jr);
+        re(jr) = tr; im(jr) = ti;
+      }
+    });
+    member.team_barrier();
+    FFT_Radix2(member, ny, -1.0, tw, re, im);
+
+    // flux at upper face of cell j is the EMF at lower face of cell j+1
+    par_for_inner(member, 0, (ny-1), [&](const int j) {
+      int jo = (compute_flux)? (j+1) % ny : j;
+      pen(m,l0,jo) = re(j)/static_cast<Real>(ny);
+      if (two) {pen(m,l1,jo) = im(j)/static_cast<Real>(ny);}
+    });
+  });
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvectionCC::PackAndSendCC_Spectral()
+//! \brief Packs x2-lines of all CC variables for forward transpose and starts transpose
+
+TaskStatus OrbitalAdvectionCC::PackAndSendCC_Spectral(DvceArray5D<Real> &a) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nl = nline, nrb = nrbx2;
+  int nc = nrbx2*(pmy_pack->nmb_thispack);
+  auto &tab = fwd_send;
+  auto &sbuf = spec_sbuf;
+  par_for("oa-pack-spec", DevExeSpace(), 0, (nc-1), 0, (nline_max-1), 0, (nx2-1),
+  KOKKOS_LAMBDA(int c, int l, int j) {
+    if (l < tab.d_view(c,3)) {
+      int gl = (tab.d_view(c,1)*nl)/nrb + l;
+      int n = gl/(nx3*nx1);
+      int k = (gl/nx1) % nx3;
+      int i = gl % nx1;
+      sbuf((tab.d_view(c,2)+l)*nx2 + j) = a(tab.d_view(c,0),n,ks+k,js+j,is+i);
+    }
+  });
+  StartTranspose(true);
+  spec_stage = 0;
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvectionCC::RecvAndUnpackCC_Spectral()
+//! \brief Completes forward transpose, shifts pencils, and unpacks shifted data after
+//! back transpose.  Returns incomplete while either transpose is still in progress.
+
+TaskStatus OrbitalAdvectionCC::RecvAndUnpackCC_Spectral(DvceArray5D<Real> &a) {
+  if (spec_stage == 0) {
+    if (!(TestTranspose())) {return TaskStatus::incomplete;}
+    UnpackToPencils();
+    ShiftPencils(false);
+    PackFromPencils();
+    StartTranspose(false);
+    spec_stage = 1;
+  }
+  if (!(TestTranspose())) {return TaskStatus::incomplete;}
+  spec_stage = 0;
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nl = nline, nrb = nrbx2;
+  int nc = nrbx2*(pmy_pack->nmb_thispack);
+  auto &tab = bck_recv;
+  auto &rbuf = spec_rbuf;
+  par_for("oa-unpk-spec", DevExeSpace(), 0, (nc-1), 0, (nline_max-1), 0, (nx2-1),
+  KOKKOS_LAMBDA(int c, int l, int j) {
+    if (l < tab.d_view(c,3)) {
+      int gl = (tab.d_view(c,1)*nl)/nrb + l;
+      int n = gl/(nx3*nx1);
+      int k = (gl/nx1) % nx3;
+      int i = gl % nx1;
+      a(tab.d_view(c,0),n,ks+k,js+j,is+i) = rbuf((tab.d_view(c,2)+l)*nx2 + j);
+    }
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvectionFC::PackAndSendFC_Spectral()
+//! \brief Packs x2-lines of B3 and B1 for forward transpose and starts transpose.  Lines
+//! include B3 at i=ie+1 and B1 at k=ke+1 so that both fields use same (k,i) ranges.
+
+TaskStatus OrbitalAdvectionFC::PackAndSendFC_Spectral(DvceFaceFld4D<Real> &b) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int nl = nline, nrb = nrbx2;
+  int nc = nrbx2*(pmy_pack->nmb_thispack);
+  auto &tab = fwd_send;
+  auto &sbuf = spec_sbuf;
+  par_for("oa-packb-spec", DevExeSpace(), 0, (nc-1), 0, (nline_max-1), 0, (nx2-1),
+  KOKKOS_LAMBDA(int c, int l, int j) {
+    if (l < tab.d_view(c,3)) {
+      int gl = (tab.d_view(c,1)*nl)/nrb + l;
+      int v = gl/((nx3+1)*(nx1+1));
+      int k = (gl/(nx1+1)) % (nx3+1);
+      int i = gl % (nx1+1);
+      int m = tab.d_view(c,0);
+      sbuf((tab.d_view(c,2)+l)*nx2 + j) = (v == 0)? b.x3f(m,ks+k,js+j,is+i) :
+                                                    b.x1f(m,ks+k,js+j,is+i);
+    }
+  });
+  StartTranspose(true);
+  spec_stage = 0;
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvectionFC::RecvAndUnpackFC_Spectral()
+//! \brief Completes forward transpose, computes effective EMFs on pencils, and after the
+//! back transpose uses them to update the face-centered fields with CT.
+
+TaskStatus OrbitalAdvectionFC::RecvAndUnpackFC_Spectral(DvceFaceFld4D<Real> &b0) {
+  if (spec_stage == 0) {
+    if (!(TestTranspose())) {return TaskStatus::incomplete;}
+    UnpackToPencils();
+    ShiftPencils(true);
+    PackFromPencils();
+    StartTranspose(false);
+    spec_stage = 1;
+  }
+  if (!(TestTranspose())) {return TaskStatus::incomplete;}
+  spec_stage = 0;
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int nx1 = indcs.nx1, nx2 = indcs.nx2, nx3 = indcs.nx3;
+  int seg = nx2 + 1;
+  int nl = nline, nrb = nrbx2;
+  int nc = nrbx2*(pmy_pack->nmb_thispack);
+  auto &tab = bck_recv;
+  auto &rbuf = spec_rbuf;
+  auto &emfx_ = emfx;
+  auto &emfz_ = emfz;
+  par_for("oa-unpkb-spec", DevExeSpace(), 0, (nc-1), 0, (nline_max-1), 0, (seg-1),
+  KOKKOS_LAMBDA(int c, int l, int j) {
+    if (l < tab.d_view(c,3)) {
+      int gl = (tab.d_view(c,1)*nl)/nrb + l;
+      int v = gl/((nx3+1)*(nx1+1));
+      int k = (gl/(nx1+1)) % (nx3+1);
+      int i = gl % (nx1+1);
+      int m = tab.d_view(c,0);
+      Real flx = rbuf((tab.d_view(c,2)+l)*seg + j);
+      // emfx = -VyBz, emfz = VyBx
+      if (v == 0) {
+        emfx_(m,ks+k,js+j,is+i) = -flx;
+      } else {
+        emfz_(m,ks+k,js+j,is+i) = flx;
+      }
+    }
+  });
+
+  UpdateFieldsCT(b0);
+  return TaskStatus::complete;
+}
@@ -25,6 +25,9 @@
 
 TaskStatus OrbitalAdvection::InitRecv() {
 #if MPI_PARALLEL_ENABLED
+  // transposes used with spectral remap are posted in PackAndSend and completed in
+  // RecvAndUnpack, so there are no boundary buffers to receive
+  if (spectral_remap) {return TaskStatus::complete;}
   const int &nmb = pmy_pack->nmb_thispack;
   const auto &nghbr = pmy_pack->pmb->nghbr;
 
@@ -74,6 +77,7 @@ TaskStatus OrbitalAdvection::InitRecv() {
 
 TaskStatus OrbitalAdvection::ClearRecv() {
 #if MPI_PARALLEL_ENABLED
+  if (spectral_remap) {return TaskStatus::complete;}
   bool no_errors=true;
   int &nmb = pmy_pack->nmb_thispack;
   auto &nghbr = pmy_pack->pmb->nghbr;
@@ -108,6 +112,7 @@ TaskStatus OrbitalAdvection::ClearRecv() {
 
 TaskStatus OrbitalAdvection::ClearSend() {
 #if MPI_PARALLEL_ENABLED
+  if (spectral_remap) {return TaskStatus::complete;}
   bool no_errors=true;
   int &nmb = pmy_pack->nmb_thispack;
   auto &nghbr = pmy_pack->pmb->nghbr;
@@ -55,4 +55,90 @@ Real ISMCoolFn(Real temp) {
   Real logcool = (lhd[ipps+1]*dx - lhd[ipps]*(dx - 0.04))*25.0;
   return pow(10.0,logcool);
 }
+
+//----------------------------------------------------------------------------------------
+// Functions used to integrate ISM cooling exactly (Townsend 2009, ApJS 181, 391).  Above
+// log(T)=4.2 ISMCoolFn() is a piecewise power law in T, with segments
+// T_k <= T < T_{k+1}, where T_k = 10^(4.2+0.04k) for k=0..98, plus a final segment
+// T >= T_99 = 10^8.15.  For isochoric cooling dT/dt = -c*Lambda(T), the temporal
+// evolution function
+//   Y(T) = (Lambda_ref/T_ref) \int_T^{T_ref} dT'/Lambda(T')
+// with T_ref = T_99 is then known analytically, and Y(T(t+dt)) = Y(T(t)) +
+// (Lambda_ref/T_ref)*c*dt.  The table built by SourceTerms stores for each segment k:
+//   tab(0,k) = T_k, tab(1,k) = power-law index, tab(2,k) = Y(T_k),
+//   tab(3,k) = (Lambda_ref/T_ref)*(T_k/Lambda(T_k))
+
+static constexpr int NISMSEG = 100;   // number of power-law segments above log(T)=4.2
+
+//----------------------------------------------------------------------------------------
+//! \fn int ISMCoolSegment()
+//! \brief returns index of power-law segment containing temperature temp >= T_0
+
+KOKKOS_INLINE_FUNCTION
+int ISMCoolSegment(const DvceArray2D<Real> &tab, const Real temp) {
+  if (temp >= tab(0,NISMSEG-1)) {return NISMSEG-1;}
+  int k = static_cast<int>(25.0*(log10(temp) - 4.2));
+  k = (k < NISMSEG-2)? k : NISMSEG-2;
+  k = (k > 0)? k : 0;
+  // correct for roundoff in log10
+  if (k < NISMSEG-2 && temp >= tab(0,k+1)) {k++;}
+  if (k > 0 && temp < tab(0,k)) {k--;}
+  return k;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real ISMCoolTownsendY()
+//! \brief temporal evolution function Y(T) in segment k
+
+KOKKOS_INLINE_FUNCTION
+Real ISMCoolTownsendY(const DvceArray2D<Real> &tab, const int k, const Real temp) {
+  Real oma = 1.0 - tab(1,k);
+  if (fabs(oma) < 1.0e-6) {
+    return tab(2,k) - tab(3,k)*log(temp/tab(0,k));
+  }
+  return tab(2,k) - tab(3,k)*(pow(temp/tab(0,k), oma) - 1.0)/oma;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real ISMCoolTownsendInvY()
+//! \brief inverse of Y(T), searching downwards in temperature from segment k.  Returns
+//! a negative value if y > Y(T_0), i.e. the temperature would fall below T_0.
+
+KOKKOS_INLINE_FUNCTION
+Real ISMCoolTownsendInvY(const DvceArray2D<Real> &tab, int k, const Real y) {
+  if (y > tab(2,0)) {return -1.0;}
+  while (k > 0 && y > tab(2,k)) {k--;}
+  Real oma = 1.0 - tab(1,k);
+  if (fabs(oma) < 1.0e-6) {
+    return tab(0,k)*exp(-(y - tab(2,k))/tab(3,k));
+  }
+  return tab(0,k)*pow(1.0 - oma*(y - tab(2,k))/tab(3,k), 1.0/oma);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real ISMCoolSubcycle()
+//! \brief Integrates dT/dt = h - c*Lambda(T) over dt with linearized backward-Euler
+//! substeps.  Substeps are limited so that T changes by at most ~10%, and so that the
+//! implicit update remains well defined in thermally unstable gas (dLambda/dT < 0).  Used
+//! where the exact integration cannot be applied.
+
+KOKKOS_INLINE_FUNCTION
+Real ISMCoolSubcycle(Real temp, const Real dt, const Real c, const Real h) {
+  const int nsub_max = 1000;
+  Real time = 0.0;
+  for (int n=0; n<nsub_max && time < dt; ++n) {
+    Real lambda = ISMCoolFn(temp);
+    Real f = h - c*lambda;
+    Real dfdt = -c*(ISMCoolFn(1.01*temp) - lambda)/(0.01*temp);
+    Real dts = dt - time;
+    if (n < nsub_max-1) {
+      if (fabs(f)*dts > 0.1*temp) {dts = 0.1*temp/fabs(f);}
+      if (dfdt*dts > 0.5) {dts = 0.5/dfdt;}
+    }
+    temp += dts*f/fmax(1.0 - dts*dfdt, 0.5);
+    time += dts;
+  }
+  return temp;
+}
+
 #endif // SRCTERMS_ISMCOOLING_HPP_
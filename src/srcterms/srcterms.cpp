@@ -10,6 +10,7 @@
 
 #include "srcterms.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <string> // string
 
@@ -18,6 +19,7 @@
 #include "coordinates/cell_locations.hpp"
 #include "eos/eos.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
+#include "gravity/gravity.hpp"
 //#include "hydro/hydro.hpp"
 #include "ismcooling.hpp"
 #include "mesh/mesh.hpp"
@@ -40,6 +42,8 @@ SourceTerms::SourceTerms(std::string block, MeshBlockPack *pp, ParameterInput *p
   ism_cooling = pin->GetOrAddBoolean(block, "ism_cooling", false);
   rel_cooling = pin->GetOrAddBoolean(block, "rel_cooling", false);
   rad_beam = pin->GetOrAddBoolean(block, "rad_beam", false);
+  // self-gravity is enabled for the fluid(s) by the <gravity> block
+  self_gravity = (pin->DoesBlockExist("gravity") && (block.compare("rad_srcterms") != 0));
 
   // (1) read data for (constant) gravitational acceleration
   if (const_accel) {
@@ -52,9 +56,21 @@ SourceTerms::SourceTerms(std::string block, MeshBlockPack *pp, ParameterInput *p
     }
   }
 
-  // (2) Optically thin ISM cooling
+  // (2) Optically thin ISM cooling.  With cooling_integrator=exact the cooling is
+  // integrated exactly over each timestep in ISMCoolingExact(), and does not limit dt
+  ism_cooling_exact = false;
   if (ism_cooling) {
     hrate = pin->GetReal(block, "hrate");
+    std::string integrator = pin->GetOrAddString(block, "cooling_integrator", "explicit");
+    if (integrator.compare("exact") == 0) {
+      ism_cooling_exact = true;
+      InitISMCoolingTable();
+    } else if (integrator.compare("explicit") != 0) {
+      std::cout << "### FATAL ERROR in "<< __FILE__ <<" at line " << __LINE__ << std::endl
+                << "<" << block << ">/cooling_integrator = '" << integrator
+                << "' not implemented, use 'explicit' or 'exact'" << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
   }
 
   // (3) optically thin relativistic cooling
@@ -83,6 +99,50 @@ SourceTerms::SourceTerms(std::string block, MeshBlockPack *pp, ParameterInput *p
 SourceTerms::~SourceTerms() {
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SourceTerms::InitISMCoolingTable()
+//! \brief Builds table of power-law segments of ISMCoolFn() above log(T)=4.2, and the
+//! values of the temporal evolution function Y(T) at the segment boundaries, used for
+//! the exact integration of ISM cooling.  See ismcooling.hpp.
+
+void SourceTerms::InitISMCoolingTable() {
+  Kokkos::realloc(ism_cool_tab, 4, NISMSEG);
+  auto tab = Kokkos::create_mirror_view(ism_cool_tab);
+
+  // segment boundaries and cooling rate at lower boundary of each segment.  Above
+  // 10^8.15 ISMCoolFn() is the power law 10^(0.45*logt - 26.065)
+  Real lambda[NISMSEG];
+  for (int k=0; k<NISMSEG; ++k) {
+    Real logt = (k < NISMSEG-1)? (4.2 + 0.04*static_cast<Real>(k)) : 8.15;
+    tab(0,k) = std::pow(10.0, logt);
+    lambda[k] = (k < NISMSEG-1)? ISMCoolFn(tab(0,k)) : std::pow(10.0, 0.45*logt-26.065);
+  }
+  // power-law index of each segment
+  for (int k=0; k<NISMSEG-1; ++k) {
+    Real lambda_kp1 = ISMCoolFn(tab(0,k+1)*(1.0 - 1.0e-12));
+    tab(1,k) = std::log(lambda_kp1/lambda[k])/std::log(tab(0,k+1)/tab(0,k));
+  }
+  tab(1,NISMSEG-1) = 0.45;
+
+  // Y(T_k), integrating downwards from T_ref = T_99 where Y=0
+  ism_cool_yfac = lambda[NISMSEG-1]/tab(0,NISMSEG-1);
+  for (int k=0; k<NISMSEG; ++k) {
+    tab(3,k) = ism_cool_yfac*tab(0,k)/lambda[k];
+  }
+  tab(2,NISMSEG-1) = 0.0;
+  for (int k=NISMSEG-2; k>=0; --k) {
+    Real oma = 1.0 - tab(1,k);
+    Real tr = tab(0,k+1)/tab(0,k);
+    if (std::abs(oma) < 1.0e-6) {
+      tab(2,k) = tab(2,k+1) + tab(3,k)*std::log(tr);
+    } else {
+      tab(2,k) = tab(2,k+1) + tab(3,k)*(std::pow(tr, oma) - 1.0)/oma;
+    }
+  }
+  Kokkos::deep_copy(ism_cool_tab, tab);
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn SourceTerms::ApplySrcTerms
 //! \brief Applies selected source terms to input arrays. Two different versions are
@@ -92,8 +152,9 @@ void SourceTerms::ApplySrcTerms(const DvceArray5D<Real> &w0, const EOS_Data &eos
                                 const Real bdt, DvceArray5D<Real> &u0) {
   // NOTE source terms must be computed using primitive (w0) and NOT conserved (u0) vars
   if (const_accel) ConstantAccel(w0, eos_data,  bdt, u0);
-  if (ism_cooling) ISMCooling(w0, eos_data, bdt, u0);
+  if (ism_cooling && !(ism_cooling_exact)) ISMCooling(w0, eos_data, bdt, u0);
   if (rel_cooling) RelCooling(w0, eos_data, bdt, u0);
+  if (self_gravity) SelfGravity(w0, eos_data, bdt, u0);
   return;
 }
 
@@ -128,6 +189,50 @@ void SourceTerms::ConstantAccel(const DvceArray5D<Real> &w0, const EOS_Data &eos
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn SourceTerms::SelfGravity
+//! \brief Add acceleration -grad(phi) of gravitational potential computed by Gravity
+//! class at the start of the stage, using centered differences of phi
+//! NOTE source terms must be computed using primitive (w0) and NOT conserved (u0) vars
+
+void SourceTerms::SelfGravity(const DvceArray5D<Real> &w0, const EOS_Data &eos_data,
+                              const Real bdt, DvceArray5D<Real> &u0) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto pgrav = pmy_pack->pgrav;
+  int io = pgrav->ioff, jo = pgrav->joff, ko = pgrav->koff;
+  auto phi = pgrav->phi;
+
+  par_for("self_grav", DevExeSpace(), 0, nmb1, ks, ke, js, je, is, ie,
+  KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    int kp = k - ko, jp = j - jo, ip = i - io;
+    Real src = bdt*w0(m,IDN,k,j,i);
+    Real g1 = -(phi(m,0,kp,jp,ip+1) - phi(m,0,kp,jp,ip-1))/(2.0*size.d_view(m).dx1);
+    Real g2 = 0.0, g3 = 0.0;
+    if (multi_d) {
+      g2 = -(phi(m,0,kp,jp+1,ip) - phi(m,0,kp,jp-1,ip))/(2.0*size.d_view(m).dx2);
+    }
+    if (three_d) {
+      g3 = -(phi(m,0,kp+1,jp,ip) - phi(m,0,kp-1,jp,ip))/(2.0*size.d_view(m).dx3);
+    }
+    u0(m,IM1,k,j,i) += src*g1;
+    u0(m,IM2,k,j,i) += src*g2;
+    u0(m,IM3,k,j,i) += src*g3;
+    if (eos_data.is_ideal) {
+      u0(m,IEN,k,j,i) += src*(g1*w0(m,IVX,k,j,i) + g2*w0(m,IVY,k,j,i) +
+                              g3*w0(m,IVZ,k,j,i));
+    }
+  });
+
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void SourceTerms::ISMCooling()
 //! \brief Add explict ISM cooling and heating source terms in the energy equations.
@@ -171,6 +276,89 @@ void SourceTerms::ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos_da
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SourceTerms::ISMCoolingExact()
+//! \brief Integrates ISM cooling and heating over a full timestep dt at constant density,
+//! operator split from the rest of the update.  Called after the conversion to
+//! primitives in the last stage of each step, and updates both w0 and u0 in all cells
+//! (including ghost zones, so no further communication is needed).  Cooling is
+//! integrated exactly using Townsend's (2009) scheme, with the (constant) heating
+//! applied in two half steps before and after.  Cells in which the temperature is, or
+//! would fall, below 10^4.2 K (where ISMCoolFn() is not a power law) are instead
+//! integrated with ISMCoolSubcycle(), and counted in EventCounters::ncool_fallback.
+
+void SourceTerms::ISMCoolingExact(DvceArray5D<Real> &w0, const EOS_Data &eos_data,
+                                  const Real dt, DvceArray5D<Real> &u0) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &ng = indcs.ng;
+  int n1 = indcs.nx1 + 2*ng;
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*ng) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*ng) : 1;
+  const int nmkji = (pmy_pack->nmb_thispack)*n3*n2*n1;
+  const int nkji = n3*n2*n1;
+  const int nji  = n2*n1;
+  bool use_e = eos_data.use_e;
+  Real gm1 = eos_data.gamma - 1.0;
+  Real tfloor = eos_data.tfloor;
+  Real pfloor = eos_data.pfloor;
+  Real temp_unit = pmy_pack->punit->temperature_cgs();
+  Real n_unit = pmy_pack->punit->density_cgs()/pmy_pack->punit->mu()
+                /pmy_pack->punit->atomic_mass_unit_cgs;
+  Real cooling_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()
+                      /n_unit/n_unit;
+  Real heating_unit = pmy_pack->punit->pressure_cgs()/pmy_pack->punit->time_cgs()/n_unit;
+  auto &tab = ism_cool_tab;
+  Real yfac = ism_cool_yfac;
+  // temperature (in K) changes as dT/dt = h - c*Lambda(T), with c proportional to density
+  Real h = gm1*temp_unit*hrate/heating_unit;
+  Real cfac = gm1*temp_unit/cooling_unit;
+  int nfallback = 0;
+
+  Kokkos::parallel_reduce("cooling_exact", Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+  KOKKOS_LAMBDA(const int &idx, int &nfb) {
+    int m = (idx)/nkji;
+    int k = (idx - m*nkji)/nji;
+    int j = (idx - m*nkji - k*nji)/n1;
+    int i = (idx - m*nkji - k*nji - j*n1);
+
+    // temperature in cgs unit
+    Real &dens = w0(m,IDN,k,j,i);
+    Real temp = 1.0;
+    if (use_e) {
+      temp = temp_unit*w0(m,IEN,k,j,i)/dens*gm1;
+    } else {
+      temp = temp_unit*w0(m,ITM,k,j,i);
+    }
+    Real c = cfac*dens;
+
+    Real temp_new = -1.0;
+    Real temp_half = temp + 0.5*h*dt;
+    if (temp_half >= tab(0,0)) {
+      int seg = ISMCoolSegment(tab, temp_half);
+      Real y = ISMCoolTownsendY(tab, seg, temp_half) + yfac*c*dt;
+      temp_new = ISMCoolTownsendInvY(tab, seg, y);
+      if (temp_new > 0.0) {temp_new += 0.5*h*dt;}
+    }
+    if (temp_new <= 0.0) {
+      temp_new = ISMCoolSubcycle(temp, dt, c, h);
+      nfb++;
+    }
+    // apply temperature and pressure floors
+    temp_new = fmax(temp_new, temp_unit*fmax(tfloor, pfloor/dens));
+
+    Real deint = dens*(temp_new - temp)/(gm1*temp_unit);
+    u0(m,IEN,k,j,i) += deint;
+    if (use_e) {
+      w0(m,IEN,k,j,i) += deint;
+    } else {
+      w0(m,ITM,k,j,i) = temp_new/temp_unit;
+    }
+  }, Kokkos::Sum<int>(nfallback));
+
+  pmy_pack->pmesh->ecounter.ncool_fallback += nfallback;
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void SourceTerms::RelCooling()
 //! \brief Add explict relativistic cooling in the energy and momentum equations.
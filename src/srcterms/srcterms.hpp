@@ -11,6 +11,9 @@
 //!  (1) constant (gravitational) acceleration - for RTI
 //!  (2) shearing box in 2D (x-z), for both hydro and MHD
 //!  (3) random forcing to drive turbulence - implemented in TurbulenceDriver class
+//!  (4) self-gravity - potential computed by Gravity class
+
+#include <float.h>
 
 #include <map>
 #include <string>
@@ -18,6 +21,78 @@
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "parameter_input.hpp"
+#include "ismcooling.hpp"
+
+//----------------------------------------------------------------------------------------
+//! \struct CoolingDtData
+//! \brief parameters needed to compute the cooling timestep in each cell with
+//! CoolingCellNewDt(), so that it can be evaluated inside the Hydro and MHD timestep
+//! kernels
+
+struct CoolingDtData {
+  bool ism_cooling, rel_cooling, use_e;
+  Real gm1;
+  Real temp_unit, cooling_unit, heating_unit, heating_rate;  // ISM cooling
+  Real cooling_rate, cooling_power;                          // relativistic cooling
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn Real CoolingCellNewDt()
+//! \brief smallest (e/cooling_rate) in cell (m,k,j,i) over all cooling source terms
+
+KOKKOS_INLINE_FUNCTION
+Real CoolingCellNewDt(const CoolingDtData &cd, const DvceArray5D<Real> &w0, const int m,
+                      const int k, const int j, const int i) {
+  Real dt = static_cast<Real>(FLT_MAX);
+  if (cd.ism_cooling) {
+    // temperature in cgs unit
+    Real temp = 1.0;
+    Real eint = 1.0;
+    if (cd.use_e) {
+      temp = cd.temp_unit*w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*cd.gm1;
+      eint = w0(m,IEN,k,j,i);
+    } else {
+      temp = cd.temp_unit*w0(m,ITM,k,j,i);
+      eint = w0(m,ITM,k,j,i)*w0(m,IDN,k,j,i)/cd.gm1;
+    }
+
+    Real lambda_cooling = ISMCoolFn(temp)/cd.cooling_unit;
+    Real gamma_heating = cd.heating_rate/cd.heating_unit;
+
+    // add a tiny number
+    Real cooling_heating = FLT_MIN + fabs(w0(m,IDN,k,j,i) *
+                           (w0(m,IDN,k,j,i) * lambda_cooling - gamma_heating));
+
+    dt = fmin((eint/cooling_heating), dt);
+  }
+
+  if (cd.rel_cooling) {
+    Real temp = 1.0;
+    Real eint = 1.0;
+    if (cd.use_e) {
+      temp = w0(m,IEN,k,j,i)/w0(m,IDN,k,j,i)*cd.gm1;
+      eint = w0(m,IEN,k,j,i);
+    } else {
+      temp = w0(m,ITM,k,j,i);
+      eint = w0(m,ITM,k,j,i)*w0(m,IDN,k,j,i)/cd.gm1;
+    }
+
+    auto &ux = w0(m, IVX, k, j, i);
+    auto &uy = w0(m, IVY, k, j, i);
+    auto &uz = w0(m, IVZ, k, j, i);
+
+    auto ut = 1. + ux * ux + uy * uy + uz * uz;
+    ut = sqrt(ut);
+
+    // The following should be approximately correct
+    // add a tiny number
+    Real cooling_heating = FLT_MIN + fabs(w0(m,IDN,k,j,i) * ut *
+                           pow(temp*cd.cooling_rate, cd.cooling_power));
+
+    dt = fmin((eint/cooling_heating), dt);
+  }
+  return dt;
+}
 
 //----------------------------------------------------------------------------------------
 //! \class SourceTerms
@@ -34,6 +109,7 @@ class SourceTerms {
   bool ism_cooling;
   bool rel_cooling;
   bool rad_beam;
+  bool self_gravity;
 
   // new timestep
   Real dtnew;
@@ -44,6 +120,9 @@ class SourceTerms {
 
   // data for ISM cooling
   Real hrate;
+  bool ism_cooling_exact;        // integrate cooling exactly, not limited by timestep
+  DvceArray2D<Real> ism_cool_tab;  // table of power-law segments for exact integration
+  Real ism_cool_yfac;              // Lambda_ref/T_ref used to normalize Y(T)
 
   // data for relativistic cooling
   Real crate_rel;
@@ -63,13 +142,19 @@ class SourceTerms {
                      const Real bdt, DvceArray5D<Real> &u0);
   void ISMCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos,
                   const Real bdt, DvceArray5D<Real> &u0);
+  void ISMCoolingExact(DvceArray5D<Real> &w0, const EOS_Data &eos,
+                       const Real dt, DvceArray5D<Real> &u0);
   void RelCooling(const DvceArray5D<Real> &w0, const EOS_Data &eos,
                   const Real bdt, DvceArray5D<Real> &u0);
+  void SelfGravity(const DvceArray5D<Real> &w0, const EOS_Data &eos,
+                   const Real bdt, DvceArray5D<Real> &u0);
   void BeamSource(DvceArray5D<Real> &i0, const Real bdt);
   void NewTimeStep(const DvceArray5D<Real> &w0, const EOS_Data &eos);
+  CoolingDtData GetDtData(const EOS_Data &eos);
 
  private:
   MeshBlockPack *pmy_pack;
+  void InitISMCoolingTable();
 };
 
 #endif  // SRCTERMS_SRCTERMS_HPP_
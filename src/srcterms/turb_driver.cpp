@@ -282,8 +282,10 @@ void TurbulenceDriver::Initialize() {
 
 void TurbulenceDriver::IncludeInitializeModesTask(std::shared_ptr<TaskList> tl,
                                                   TaskID start) {
-  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start);
-  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init);
+  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start,
+                             "TurbulenceDriver::InitializeModes");
+  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init,
+                            "TurbulenceDriver::AddForcing");
   return;
 }
 
@@ -298,15 +300,18 @@ void TurbulenceDriver::IncludeAddForcingTask(std::shared_ptr<TaskList> tl, TaskI
   if (pmy_pack->pionn == nullptr) {
     if (pmy_pack->phydro != nullptr) {
       auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                              pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt);
+                              pmy_pack->phydro->id.flux, pmy_pack->phydro->id.rkupdt,
+                              "TurbulenceDriver::AddForcing");
     }
     if (pmy_pack->pmhd != nullptr) {
       auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                              pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt);
+                              pmy_pack->pmhd->id.flux, pmy_pack->pmhd->id.rkupdt,
+                              "TurbulenceDriver::AddForcing");
     }
   } else {
     auto id = tl->InsertTask(&TurbulenceDriver::AddForcing, this,
-                            pmy_pack->pionn->id.n_flux, pmy_pack->pionn->id.n_rkupdt);
+                            pmy_pack->pionn->id.n_flux, pmy_pack->pionn->id.n_rkupdt,
+                            "TurbulenceDriver::AddForcing");
   }
 
   return;
@@ -13,17 +13,19 @@
 // This version includes improvements due to Josh Dolence and the Parthenon dev team, and
 // extensions by J.M.Stone.
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
-#include <bitset>
 #include <functional>
 #include <vector>
 #include <list>
 #include <iterator>
+#include <string>
 
-class Driver;
+#include "tasklist/task_profiler.hpp"
 
-// Maximum size of TL
-#define NUMBER_TASKID_BITS 64
+class Driver;
 
 // constants = return codes for functions working on individual Tasks and TaskList
 enum class TaskStatus {fail, complete, incomplete};
@@ -31,52 +33,91 @@ enum class TaskListStatus {running, stuck, complete, nothing_to_do};
 
 //----------------------------------------------------------------------------------------
 //! \class TaskID
-//  \brief container class for bit fields (used to encode Task IDs) and access functions
+//  \brief container class for bit fields (used to encode Task IDs) and access functions.
+//  The bit field is stored in 64-bit words that are allocated as needed, so there is no
+//  limit on the number of Tasks in a TaskList.  Words above the highest set bit are never
+//  stored, so that TaskIDs with the same bits set compare equal.
 
 class TaskID {
  public:
   TaskID() = default;
   // ctor, default id = 0.
   explicit TaskID(unsigned int id) {
-    if (id == 0) {
-      bitfld_.reset();      // set all bits to zero
-    } else {
-      bitfld_.set((--id));  // set [id-1] bit to one
+    if (id != 0) {
+      --id;                 // set [id-1] bit to one
+      bitfld_.assign(id/64 + 1, 0);
+      bitfld_[id/64] = (static_cast<std::uint64_t>(1) << (id % 64));
     }
   }
 
   // functions (all implemented here)
-  void Clear() { bitfld_.reset(); }  // set all bits to zero
+  void Clear() { bitfld_.clear(); }  // set all bits to zero
   // return true if input dependencies are clear
   bool CheckDependencies(const TaskID &dep) const {
-    return ((bitfld_ & dep.bitfld_) == dep.bitfld_);
+    if (dep.bitfld_.size() > bitfld_.size()) return false;
+    for (std::size_t n=0; n<dep.bitfld_.size(); ++n) {
+      if ((bitfld_[n] & dep.bitfld_[n]) != dep.bitfld_[n]) return false;
+    }
+    return true;
   }
   // output ID (useful for debugging)
-  void PrintID() {std::cout << "TaskID = " << bitfld_.to_string() << std::endl;}
+  void PrintID() const {
+    std::cout << "TaskID = ";
+    for (int n=static_cast<int>(bitfld_.size())-1; n>=0; --n) {
+      for (int b=63; b>=0; --b) {std::cout << ((bitfld_[n] >> b) & 1);}
+    }
+    std::cout << std::endl;
+  }
   // mark task with input TaskID as complete
-  void SetComplete(const TaskID &rhs) { bitfld_ |= rhs.bitfld_; }
+  void SetComplete(const TaskID &rhs) {
+    if (rhs.bitfld_.size() > bitfld_.size()) {bitfld_.resize(rhs.bitfld_.size(), 0);}
+    for (std::size_t n=0; n<rhs.bitfld_.size(); ++n) {bitfld_[n] |= rhs.bitfld_[n];}
+  }
+  // return indices of all bits that are set
+  std::vector<int> GetBits() const {
+    std::vector<int> bits;
+    for (std::size_t n=0; n<bitfld_.size(); ++n) {
+      for (int b=0; b<64; ++b) {
+        if ((bitfld_[n] >> b) & 1) {bits.push_back(64*static_cast<int>(n) + b);}
+      }
+    }
+    return bits;
+  }
 
   // overload some operators
   bool operator== (const TaskID &rhs) const {return (bitfld_ == rhs.bitfld_); }
   bool operator!= (const TaskID &rhs) const {return (bitfld_ != rhs.bitfld_); }
   TaskID operator| (const TaskID &rhs) const {
-    TaskID ret;
-    ret.bitfld_ = (bitfld_ | rhs.bitfld_);
+    TaskID ret = (bitfld_.size() >= rhs.bitfld_.size()) ? *this : rhs;
+    const TaskID &other = (bitfld_.size() >= rhs.bitfld_.size()) ? rhs : *this;
+    for (std::size_t n=0; n<other.bitfld_.size(); ++n) {
+      ret.bitfld_[n] |= other.bitfld_[n];
+    }
     return ret;
   }
   TaskID operator^ (const TaskID &rhs) const {
-    TaskID ret;
-    ret.bitfld_ = (bitfld_ ^ rhs.bitfld_);
+    TaskID ret = (bitfld_.size() >= rhs.bitfld_.size()) ? *this : rhs;
+    const TaskID &other = (bitfld_.size() >= rhs.bitfld_.size()) ? rhs : *this;
+    for (std::size_t n=0; n<other.bitfld_.size(); ++n) {
+      ret.bitfld_[n] ^= other.bitfld_[n];
+    }
+    ret.Trim();
     return ret;
   }
   TaskID operator& (const TaskID &rhs) const {
-    TaskID ret;
-    ret.bitfld_ = (bitfld_ & rhs.bitfld_);
+    TaskID ret = (bitfld_.size() <= rhs.bitfld_.size()) ? *this : rhs;
+    const TaskID &other = (bitfld_.size() <= rhs.bitfld_.size()) ? rhs : *this;
+    for (std::size_t n=0; n<ret.bitfld_.size(); ++n) {
+      ret.bitfld_[n] &= other.bitfld_[n];
+    }
+    ret.Trim();
     return ret;
   }
 
  private:
-  std::bitset<NUMBER_TASKID_BITS> bitfld_;
+  std::vector<std::uint64_t> bitfld_;
+  // remove words above the highest set bit
+  void Trim() { while (!bitfld_.empty() && bitfld_.back() == 0) {bitfld_.pop_back();} }
 };
 
 //----------------------------------------------------------------------------------------
@@ -86,12 +127,14 @@ class TaskID {
 
 class Task {
  public:
-  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func) :
-  myid_(id), dep_(dep), func_(func) {}
+  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func,
+       const std::string &name) :
+  myid_(id), dep_(dep), func_(func), name_(name) {}
   // overloaded operator() calls task function
   TaskStatus operator()(Driver *d, int s) {return func_(d,s);}
-  TaskID GetID() {return myid_;}
-  TaskID GetDependency() {return dep_;}
+  const TaskID &GetID() const {return myid_;}
+  const TaskID &GetDependency() const {return dep_;}
+  const std::string &GetName() const {return name_;}
   void SetComplete() {complete_ = true;}
   void SetIncomplete() {complete_ = false;}
   bool IsComplete() {return complete_;}
@@ -106,6 +149,7 @@ class Task {
   // bool lb_time_;   // flag to include this task in timing for automatic load balancing
   bool complete_ = false;
   std::function<TaskStatus(Driver*, int)> func_;  // ptr to Task function
+  std::string name_;  // name of Task used by TaskProfiler
 };
 
 //----------------------------------------------------------------------------------------
@@ -119,41 +163,62 @@ class TaskList {
 
   // functions (all implemented here)
   bool IsComplete() {
-    // cycle through task list and check if each task completed
-    for (auto &it : task_list_) {
-      auto id = it.GetID();
-      if (!(tasks_completed_.CheckDependencies(id))) return false;
-    }
-    // everything is done
-    return true;
+    if (!graph_built_) {BuildGraph();}
+    return (nremaining_ == 0);
   }
   int Size() {return task_list_.size();}
   bool Empty() {return task_list_.empty();}
-  void MarkTaskComplete(TaskID id) { tasks_completed_.SetComplete(id); }
+  void MarkTaskComplete(const TaskID &id) { tasks_completed_.SetComplete(id); }
   TaskID GetIDLastTask() {return task_list_.back().GetID();}
   // output diagnostics (useful for debugging)
   void PrintIDs() { for (auto &it : task_list_) {it.GetID().PrintID();} }
   void PrintDependencies() { for (auto &it : task_list_) {it.GetDependency().PrintID();} }
 
-  //
+  // reset all tasks to incomplete, and mark tasks with no dependencies as ready
   void Reset() {
+    if (!graph_built_) {BuildGraph();}
     tasks_completed_.Clear();  // TaskID Clear() fn
     for (auto &it : task_list_) { it.SetIncomplete(); }
+    std::fill(ready_.begin(), ready_.end(), 0);
+    for (int n=0; n<static_cast<int>(task_ptr_.size()); ++n) {
+      nwaiting_[n] = ndeps_[n];
+      if (ndeps_[n] == 0) {SetReady(n);}
+    }
+    nremaining_ = static_cast<int>(task_ptr_.size());
   }
 
-  // cycle through task list once, do any tasks whose dependencies are clear
-  TaskListStatus DoAvailable(Driver *d, int s) {
-    for (auto &task : task_list_) {
-      auto dep = task.GetDependency();
-      if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
-        TaskStatus status = task(d,s);  // calls Task function using overloaded operator()
-        if (status == TaskStatus::complete) {
-          task.SetComplete();              // set bool flag in task
-          MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+  // cycle once through the tasks whose dependencies are clear, in order of their position
+  // in the task list.  Completing a task decrements the count of outstanding dependencies
+  // of its successors, and marks those with none left as ready.  Successors later in the
+  // task list are run during the same cycle, so tasks are executed in the same order as
+  // when checking the dependencies of every task in the list.  If a TaskProfiler is
+  // passed, each call to a Task function is timed.
+  TaskListStatus DoAvailable(Driver *d, int s, TaskProfiler *pprof = nullptr) {
+    if (!graph_built_) {Reset();}
+    if (pprof != nullptr) {pprof->CountSweep();}
+    for (int n = NextReady(0); n >= 0; n = NextReady(n+1)) {
+      Task &task = *task_ptr_[n];
+      TaskStatus status;
+      if (pprof == nullptr) {
+        status = task(d,s);  // calls Task function using overloaded operator()
+      } else {
+        double t0 = pprof->BeginTask(task.GetName());
+        status = task(d,s);
+        pprof->EndTask(task.GetName(), t0, (status == TaskStatus::complete));
+      }
+      if (status == TaskStatus::complete) {
+        task.SetComplete();              // set bool flag in task
+        MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+        ready_[n/64] &= ~(static_cast<std::uint64_t>(1) << (n % 64));
+        nremaining_--;
+        // successors earlier in the task list are run in the next cycle
+        for (int l=succ_start_[n]; l<succ_start_[n+1]; ++l) {
+          int m = successors_[l];
+          if (--nwaiting_[m] == 0) {SetReady(m);}
         }
       }
     }
-    if (IsComplete()) return TaskListStatus::complete;
+    if (nremaining_ == 0) return TaskListStatus::complete;
     return TaskListStatus::running;
   }
 
@@ -162,44 +227,49 @@ class TaskList {
   // arguments (Driver*, int). Usage:
   //     taskid = tl.AddTask(DoSomething, dependency, name);
   template <class F>
-  TaskID AddTask(F func, TaskID &dep) {
+  TaskID AddTask(F func, TaskID &dep, const std::string &name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(
-      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);}));
+    task_list_.push_back(Task(id, dep,
+       [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);}, name));
+    graph_built_ = false;
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a member function of
   // class T to the end of task list.  Returns ID of new task. Task function must have
   // arguments (Driver*, int).  Usage:
-  //     taskid = tl.AddTask(&T::DoSomething, T, dependency);
+  //     taskid = tl.AddTask(&T::DoSomething, T, dependency, name);
   template <class F, class T>
-  TaskID AddTask(F func, T *obj, TaskID &dep) {
+  TaskID AddTask(F func, T *obj, TaskID &dep, const std::string &name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
     task_list_.push_back( Task(id, dep,
-       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}) );
+       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}, name) );
+    graph_built_ = false;
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a std::function to the end of task
   // list. Returns ID of new task. Task function must have arguments (Driver*, int).
   // Usage:
-  //      taskid = tl.AddTask(DoSomething, dependency);
-  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep) {
+  //      taskid = tl.AddTask(DoSomething, dependency, name);
+  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep,
+                 const std::string &name = "") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(Task(id, dep, func));
+    task_list_.push_back(Task(id, dep, func, name));
+    graph_built_ = false;
     return id;
   }
 
   // INSERT new Task with ID, given dependency, and a pointer to a member function of
   // class T in a position BEFORE the task with ID 'location'.  Returns ID of new task,
   // or taskID(0) if location not found. Usage:
-  //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location);
+  //     taskid = tl.InsertTask(&T::DoSomething, T, dependency, location, name);
   template <class F, class T>
-  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc) {
+  TaskID InsertTask(F func, T *obj, TaskID &dep, TaskID &loc,
+                    const std::string &name = "") {
     std::list<Task>::iterator it;
     for (it=task_list_.begin(); it!=task_list_.end(); ++it) {
       if (it->GetID() == loc) {
@@ -207,13 +277,15 @@ class TaskList {
         TaskID id(size+1);
         auto old_dep = it->GetDependency();
         task_list_.insert(it, Task(id, dep,
-           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); }));
+           [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s); },
+           name));
         // now change dependencies for all but this newly added Task
         for (auto it2=task_list_.begin(); it2!=task_list_.end(); ++it2) {
           if (it2->GetID() != id) {
             it2->ChangeDependency(old_dep, id);
           }
         }
+        graph_built_ = false;
         return id;
       }
     }
@@ -223,6 +295,76 @@ class TaskList {
  protected:
   std::list<Task> task_list_;
   TaskID tasks_completed_;
+
+  // task graph, built from the dependencies in task_list_ the first time the list is
+  // Reset() or executed after tasks were added.  Tasks are indexed by their position in
+  // task_list_.
+  bool graph_built_ = false;
+  std::vector<Task*> task_ptr_;             // pointers to tasks in task_list_
+  // tasks that depend on task n are successors_[succ_start_[n]...succ_start_[n+1]-1]
+  std::vector<int> succ_start_;
+  std::vector<int> successors_;
+  std::vector<int> ndeps_;                  // number of dependencies of each task
+  std::vector<int> nwaiting_;               // number of dependencies not yet complete
+  std::vector<std::uint64_t> ready_;        // bit n set if task n is ready to run
+  int nremaining_ = 0;                      // number of tasks not yet complete
+
+  void BuildGraph() {
+    int ntask = static_cast<int>(task_list_.size());
+    task_ptr_.clear();
+    succ_start_.assign(ntask+1, 0);
+    successors_.clear();
+    ndeps_.assign(ntask, 0);
+    nwaiting_.assign(ntask, 0);
+    ready_.assign((ntask + 63)/64, 0);
+    // map from bit in TaskID to position in task list
+    std::vector<int> index;
+    for (auto &it : task_list_) {
+      int n = static_cast<int>(task_ptr_.size());
+      for (int b : it.GetID().GetBits()) {
+        if (b >= static_cast<int>(index.size())) {index.resize(b+1, -1);}
+        index[b] = n;
+      }
+      task_ptr_.push_back(&it);
+    }
+    std::vector<std::vector<int>> deps(ntask);
+    for (int n=0; n<ntask; ++n) {
+      for (int b : task_ptr_[n]->GetDependency().GetBits()) {
+        if (b >= static_cast<int>(index.size()) || index[b] < 0) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "Task '" << task_ptr_[n]->GetName() << "' depends on "
+                    << "a task that is not in the same TaskList" << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+        deps[n].push_back(index[b]);
+        succ_start_[index[b]+1]++;
+      }
+      ndeps_[n] = static_cast<int>(deps[n].size());
+    }
+    // store successors of all tasks contiguously
+    for (int n=0; n<ntask; ++n) {succ_start_[n+1] += succ_start_[n];}
+    successors_.resize(succ_start_[ntask]);
+    std::vector<int> nsucc(succ_start_.begin(), succ_start_.end()-1);
+    for (int n=0; n<ntask; ++n) {
+      for (int p : deps[n]) {successors_[nsucc[p]++] = n;}
+    }
+    graph_built_ = true;
+    Reset();
+  }
+
+  void SetReady(int n) {ready_[n/64] |= (static_cast<std::uint64_t>(1) << (n % 64));}
+  // return position of first ready task at or after position n, or -1 if there is none
+  int NextReady(int n) const {
+    int nword = static_cast<int>(ready_.size());
+    int w = n/64;
+    if (w >= nword) {return -1;}
+    std::uint64_t word = ready_[w] & (~static_cast<std::uint64_t>(0) << (n % 64));
+    while (word == 0) {
+      if (++w == nword) {return -1;}
+      word = ready_[w];
+    }
+    return 64*w + __builtin_ctzll(word);
+  }
 };
 
 #endif  // TASKLIST_TASK_LIST_HPP_
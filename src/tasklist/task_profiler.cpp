@@ -0,0 +1,248 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file task_profiler.cpp
+//! \brief implementation of TaskProfiler class, see task_profiler.hpp
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "task_profiler.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+// TaskProfiler constructor
+
+TaskProfiler::TaskProfiler(ParameterInput *pin) :
+    tl_name_(""),
+    stage_(0),
+    tl_start_(0.0),
+    nsweeps_(0),
+    ndropped_(0) {
+  fence_ = pin->GetOrAddBoolean("profiler", "fence", true);
+  trace_ = pin->GetOrAddBoolean("profiler", "trace", true);
+  max_events_ = pin->GetOrAddInteger("profiler", "max_events", 1000000);
+  if (max_events_ < 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<profiler>/max_events = " << max_events_
+              << " must be non-negative" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  // synchronize ranks so that times in traces from different ranks are comparable
+#if MPI_PARALLEL_ENABLED
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  timer_.reset();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::BeginTaskList()
+//! \brief start timing execution of the TaskList 'tl_name' for the given stage
+
+void TaskProfiler::BeginTaskList(const std::string &tl_name, int stage) {
+  if (fence_) {Kokkos::fence();}
+  tl_name_ = tl_name;
+  stage_ = stage;
+  nsweeps_ = 0;
+  tl_start_ = timer_.seconds();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::EndTaskList()
+//! \brief stop timing execution of the current TaskList
+
+void TaskProfiler::EndTaskList() {
+  if (fence_) {Kokkos::fence();}
+  double dt = timer_.seconds() - tl_start_;
+  auto &stats = tl_stats_[std::make_pair(tl_name_, stage_)];
+  stats.ncalls++;
+  stats.nsweeps += nsweeps_;
+  stats.time += dt;
+  AddEvent(tl_name_, tl_start_, dt, dt, -1);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn double TaskProfiler::BeginTask()
+//! \brief called before each Task function, returns start time.  Also opens a Kokkos
+//! profiling region so that kernels can be attributed to Tasks by Kokkos tools.
+
+double TaskProfiler::BeginTask(const std::string &name) {
+  Kokkos::Profiling::pushRegion(name);
+  return timer_.seconds();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::EndTask()
+//! \brief called after each Task function, accumulates wall and device time
+
+void TaskProfiler::EndTask(const std::string &name, double t0, bool complete) {
+  double t1 = timer_.seconds();
+  double t2 = t1;
+  if (fence_) {
+    Kokkos::fence();
+    t2 = timer_.seconds();
+  }
+  Kokkos::Profiling::popRegion();
+
+  auto &stats = task_stats_[std::make_tuple(tl_name_, stage_, name)];
+  if (complete) {
+    stats.ncalls++;
+  } else {
+    stats.npolls++;
+  }
+  stats.wall += (t1 - t0);
+  stats.device += (t2 - t0);
+  stats.max_device = std::max(stats.max_device, t2 - t0);
+  AddEvent(name, t0, t2 - t0, t1 - t0, (complete ? 1 : 0));
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int TaskProfiler::NameIndex()
+//! \brief returns index of name in names_, adding it if not yet stored
+
+int TaskProfiler::NameIndex(const std::string &name) {
+  auto it = name_index_.find(name);
+  if (it != name_index_.end()) {return it->second;}
+  int n = static_cast<int>(names_.size());
+  names_.push_back(name);
+  name_index_[name] = n;
+  return n;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::AddEvent()
+//! \brief store trace event, unless the limit on the number of events has been reached
+
+void TaskProfiler::AddEvent(const std::string &name, double ts, double dur, double wall,
+                            int status) {
+  if (!trace_) {return;}
+  if (static_cast<int>(events_.size()) >= max_events_) {
+    ndropped_++;
+    return;
+  }
+  TraceEvent ev;
+  ev.name = NameIndex(name);
+  ev.cat = NameIndex(tl_name_);
+  ev.stage = stage_;
+  ev.ts = ts;
+  ev.dur = dur;
+  ev.wall = wall;
+  ev.status = status;
+  events_.push_back(ev);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::WriteOutput()
+//! \brief Each rank writes its summary table to "basename.rank_XXXXXXXX.prof" and its
+//! trace to "basename.rank_XXXXXXXX.trace.json".  The table for rank 0 is also printed
+//! to stdout.
+
+void TaskProfiler::WriteOutput(const std::string &basename) {
+  char rank_str[20];
+  std::snprintf(rank_str, sizeof(rank_str), ".rank_%08d", global_variable::my_rank);
+
+  // sort Tasks by total device time
+  using TaskEntry = std::pair<std::tuple<std::string, int, std::string>, TaskStats>;
+  std::vector<TaskEntry> tasks(task_stats_.begin(), task_stats_.end());
+  std::stable_sort(tasks.begin(), tasks.end(),
+                   [](const TaskEntry &a, const TaskEntry &b) {
+                     return a.second.device > b.second.device;});
+  double tl_total = 0.0;
+  for (auto &it : tl_stats_) {tl_total += it.second.time;}
+
+  // build summary table
+  std::stringstream table;
+  table << std::endl << "Task profile for rank " << global_variable::my_rank
+        << " (times in seconds, fence=" << (fence_ ? "true" : "false") << ")"
+        << std::endl;
+  table << std::left << std::setw(22) << "TaskList" << std::right << std::setw(6)
+        << "stage" << std::setw(10) << "calls" << std::setw(10) << "sweeps"
+        << std::setw(13) << "time" << std::setw(13) << "in tasks"
+        << std::setw(13) << "overhead" << std::endl;
+  for (auto &it : tl_stats_) {
+    double in_tasks = 0.0;
+    for (auto &t : task_stats_) {
+      if (std::get<0>(t.first) == it.first.first &&
+          std::get<1>(t.first) == it.first.second) {
+        in_tasks += t.second.device;
+      }
+    }
+    table << std::left << std::setw(22) << it.first.first << std::right
+          << std::setw(6) << it.first.second << std::setw(10) << it.second.ncalls
+          << std::setw(10) << it.second.nsweeps << std::scientific << std::setprecision(4)
+          << std::setw(13) << it.second.time << std::setw(13) << in_tasks
+          << std::setw(13) << (it.second.time - in_tasks) << std::endl;
+    table.unsetf(std::ios_base::floatfield);
+  }
+  table << std::endl;
+  table << std::left << std::setw(22) << "TaskList" << std::right << std::setw(6)
+        << "stage" << "  " << std::left << std::setw(32) << "Task" << std::right
+        << std::setw(9) << "calls" << std::setw(10) << "polls" << std::setw(12)
+        << "wall" << std::setw(12) << "device" << std::setw(12) << "max" << std::setw(8)
+        << "%" << std::endl;
+  for (auto &it : tasks) {
+    const std::string &name = std::get<2>(it.first);
+    table << std::left << std::setw(22) << std::get<0>(it.first) << std::right
+          << std::setw(6) << std::get<1>(it.first) << "  " << std::left << std::setw(32)
+          << (name.empty() ? "(unnamed)" : name) << std::right
+          << std::setw(9) << it.second.ncalls << std::setw(10) << it.second.npolls
+          << std::scientific << std::setprecision(4) << std::setw(12) << it.second.wall
+          << std::setw(12) << it.second.device << std::setw(12) << it.second.max_device
+          << std::fixed << std::setprecision(2) << std::setw(8)
+          << ((tl_total > 0.0) ? 100.0*it.second.device/tl_total : 0.0) << std::endl;
+    table.unsetf(std::ios_base::floatfield);
+  }
+
+  std::string fname = basename + rank_str + ".prof";
+  std::ofstream ofs(fname);
+  ofs << table.str();
+  ofs.close();
+  if (global_variable::my_rank == 0) {
+    std::cout << table.str();
+    std::cout << std::endl << "Task profiles written to " << basename
+              << ".rank_*.prof" << (trace_ ? " and .rank_*.trace.json" : "") << std::endl;
+  }
+  if (!trace_) {return;}
+
+  // write trace in Chrome trace event format, times in microseconds
+  fname = basename + rank_str + ".trace.json";
+  std::ofstream ofs_trace(fname);
+  int rank = global_variable::my_rank;
+  ofs_trace << std::fixed << std::setprecision(3);
+  ofs_trace << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":"
+            << ndropped_ << "},\"traceEvents\":[" << std::endl;
+  ofs_trace << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+            << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank << "\"}}";
+  for (auto &ev : events_) {
+    const std::string &name = names_[ev.name];
+    ofs_trace << "," << std::endl << "{\"name\":\""
+              << (name.empty() ? "(unnamed)" : name) << "\",\"cat\":\""
+              << names_[ev.cat] << "\",\"ph\":\"X\",\"pid\":" << rank
+              << ",\"tid\":0,\"ts\":" << 1.0e6*ev.ts << ",\"dur\":" << 1.0e6*ev.dur
+              << ",\"args\":{\"stage\":" << ev.stage;
+    if (ev.status >= 0) {
+      ofs_trace << ",\"wall_us\":" << 1.0e6*ev.wall << ",\"status\":\""
+                << ((ev.status == 1) ? "complete" : "incomplete") << "\"";
+    }
+    ofs_trace << "}}";
+  }
+  ofs_trace << std::endl << "]}" << std::endl;
+  ofs_trace.close();
+  return;
+}
@@ -0,0 +1,97 @@
+#ifndef TASKLIST_TASK_PROFILER_HPP_
+#define TASKLIST_TASK_PROFILER_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file task_profiler.hpp
+//! \brief Opt-in profiler for TaskLists, enabled by including a <profiler> block in the
+//! input file.  Each call to a Task function in TaskList::DoAvailable() is timed, and the
+//! results are accumulated per TaskList, stage, and named Task on each rank.  Calls that
+//! return TaskStatus::incomplete (e.g. a receive that is still waiting on MPI) are
+//! counted as polls.  At the end of the run each rank writes a summary table and a trace
+//! of all calls in the Chrome trace event format (readable by chrome://tracing or
+//! https://ui.perfetto.dev).
+//!
+//! Two times are recorded for each call:
+//!  - wall: time spent in the Task function on the host (including asynchronous kernel
+//!    launches, but not the kernels themselves)
+//!  - device: time until the device is idle again, measured by calling Kokkos::fence()
+//!    after the Task function returns (only if <profiler>/fence=true, otherwise equal to
+//!    the wall time).
+//! Fencing serializes execution, so it changes the timing of a run being profiled.
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+
+class ParameterInput;
+
+//----------------------------------------------------------------------------------------
+//! \class TaskProfiler
+
+class TaskProfiler {
+ public:
+  explicit TaskProfiler(ParameterInput *pin);
+  ~TaskProfiler() = default;
+
+  // functions called by Driver::ExecuteTaskList()
+  void BeginTaskList(const std::string &tl_name, int stage);
+  void EndTaskList();
+  // functions called by TaskList::DoAvailable()
+  void CountSweep() {nsweeps_++;}
+  double BeginTask(const std::string &name);
+  void EndTask(const std::string &name, double t0, bool complete);
+  // write summary table and trace at end of run (called by Driver::Finalize())
+  void WriteOutput(const std::string &basename);
+
+ private:
+  bool fence_;         // fence device after each Task to measure device time
+  bool trace_;         // record trace events
+  int max_events_;     // maximum number of trace events stored on each rank
+  Kokkos::Timer timer_;
+
+  // TaskList currently executing
+  std::string tl_name_;
+  int stage_;
+  double tl_start_;
+  int nsweeps_;
+
+  // accumulated statistics per (TaskList, stage, Task)
+  struct TaskStats {
+    int ncalls = 0;          // calls that returned TaskStatus::complete
+    int npolls = 0;          // calls that returned TaskStatus::incomplete
+    double wall = 0.0;       // total wall time [s]
+    double device = 0.0;     // total fence-adjusted time [s]
+    double max_device = 0.0; // maximum fence-adjusted time of a single call [s]
+  };
+  // accumulated statistics per (TaskList, stage)
+  struct TaskListStats {
+    int ncalls = 0;          // number of times TaskList was executed
+    int nsweeps = 0;         // number of passes through TaskList in DoAvailable()
+    double time = 0.0;       // total time spent in ExecuteTaskList() [s]
+  };
+  std::map<std::tuple<std::string, int, std::string>, TaskStats> task_stats_;
+  std::map<std::pair<std::string, int>, TaskListStats> tl_stats_;
+
+  // trace events, names are stored as indices into names_
+  struct TraceEvent {
+    int name, cat, stage;
+    double ts, dur, wall;    // start, fence-adjusted and wall duration [s]
+    int status;              // 0: incomplete (poll), 1: complete, -1: TaskList
+  };
+  std::vector<TraceEvent> events_;
+  std::vector<std::string> names_;
+  std::map<std::string, int> name_index_;
+  int ndropped_;
+
+  int NameIndex(const std::string &name);
+  void AddEvent(const std::string &name, double ts, double dur, double wall, int status);
+};
+
+#endif // TASKLIST_TASK_PROFILER_HPP_
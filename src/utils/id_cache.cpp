@@ -0,0 +1,338 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file id_cache.cpp
+//! \brief implements functions in InitialDataCache class
+
+#include <dirent.h>    // opendir, readdir
+#include <sys/stat.h>  // mkdir, stat
+
+#include <algorithm>   // sort
+#include <cinttypes>   // PRIx64
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "id_cache.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace {
+constexpr std::uint64_t kMagic = 0x4149444341434845ULL;  // "AIDCACHE"
+
+//----------------------------------------------------------------------------------------
+//! \fn void HashBytes()
+//! \brief 64-bit FNV-1a hash of n bytes, accumulated into h
+
+void HashBytes(std::uint64_t &h, const void *data, std::size_t n) {
+  const unsigned char *p = static_cast<const unsigned char*>(data);
+  for (std::size_t i=0; i<n; ++i) {
+    h ^= static_cast<std::uint64_t>(p[i]);
+    h *= 0x100000001b3ULL;
+  }
+}
+
+void HashString(std::uint64_t &h, const std::string &s) {
+  HashBytes(h, s.data(), s.size());
+  HashBytes(h, "\0", 1);   // separator, so that {"ab","c"} and {"a","bc"} differ
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void HashFile()
+//! \brief Hashes contents of a regular file.  If path is a directory (e.g. SGRID
+//! datadir), hashes names and contents of all regular files it contains.  Returns false
+//! if path cannot be read.
+
+bool HashFile(std::uint64_t &h, const std::string &path) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) return false;
+  if (S_ISDIR(st.st_mode)) {
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr) return false;
+    std::vector<std::string> names;
+    for (struct dirent *ent = readdir(dir); ent != nullptr; ent = readdir(dir)) {
+      std::string name(ent->d_name);
+      struct stat est;
+      if (stat((path + "/" + name).c_str(), &est) == 0 && S_ISREG(est.st_mode)) {
+        names.push_back(name);
+      }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    for (auto &name : names) {
+      HashString(h, name);
+      if (!HashFile(h, path + "/" + name)) return false;
+    }
+    return true;
+  }
+  std::FILE *fp = std::fopen(path.c_str(), "rb");
+  if (fp == nullptr) return false;
+  std::vector<char> buf(1 << 20);
+  std::size_t n;
+  while ((n = std::fread(buf.data(), 1, buf.size(), fp)) > 0) {
+    HashBytes(h, buf.data(), n);
+  }
+  std::fclose(fp);
+  return true;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+// constructor: computes key (on root, then broadcast to all ranks).  Only parameters in
+// the listed input blocks (and <problem>, always) are included in the key, so that e.g.
+// changing the time limit or outputs still reuses the cached initial data.
+
+InitialDataCache::InitialDataCache(ParameterInput *pin, Mesh *pm,
+                                   const std::string &id_file,
+                                   const std::vector<std::string> &blocks) :
+    enabled(false),
+    key(0),
+    pmy_mesh(pm) {
+  if (!pin->DoesParameterExist("problem", "id_cache_dir")) return;
+  enabled = true;
+  std::string dir = pin->GetString("problem", "id_cache_dir");
+
+  if (global_variable::my_rank == 0) {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    // initial data file
+    HashString(h, id_file);
+    if (!id_file.empty() && !HashFile(h, id_file)) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "Cannot read initial data file '" << id_file << "', only its name "
+                << "is used in key of initial data cache" << std::endl;
+    }
+    // parameters controlling the import
+    std::vector<std::string> blks(blocks);
+    blks.insert(blks.begin(), "problem");
+    for (auto &bname : blks) {
+      for (auto &blk : pin->block) {
+        if (blk.block_name != bname) continue;
+        HashString(h, blk.block_name);
+        for (auto &ln : blk.line) {
+          if (blk.block_name == "problem" && ln.param_name == "id_cache_dir") continue;
+          HashString(h, ln.param_name);
+          HashString(h, ln.param_value);
+        }
+      }
+    }
+    // mesh description
+    RegionSize &ms = pm->mesh_size;
+    Real xmesh[6] = {ms.x1min, ms.x2min, ms.x3min, ms.x1max, ms.x2max, ms.x3max};
+    HashBytes(h, xmesh, sizeof(xmesh));
+    int nmesh[8] = {pm->mesh_indcs.nx1, pm->mesh_indcs.nx2, pm->mesh_indcs.nx3,
+                    pm->mb_indcs.nx1, pm->mb_indcs.nx2, pm->mb_indcs.nx3,
+                    pm->mb_indcs.ng, pm->nmb_total};
+    HashBytes(h, nmesh, sizeof(nmesh));
+    HashBytes(h, pm->lloc_eachmb, pm->nmb_total*sizeof(LogicalLocation));
+    key = h;
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(&key, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+#endif
+
+  char hex[17];
+  std::snprintf(hex, sizeof(hex), "%016" PRIx64, key);
+  path = dir + "/" + hex;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::string InitialDataCache::MeshBlockFileName(int gid)
+//! \brief name of snapshot file for MeshBlock gid
+
+std::string InitialDataCache::MeshBlockFileName(int gid) const {
+  char name[16];
+  std::snprintf(name, sizeof(name), "mb%08d.bin", gid);
+  return path + "/" + name;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool InitialDataCache::Load()
+//! \brief Reads snapshots of all MeshBlocks on this rank into the arrays in vars (on all
+//! MeshBlocks in the pack), and the scalars (e.g. positions of compact objects) saved by
+//! the pgen into scalars, which must be sized by the caller.  Files are read in parallel
+//! on the host.  Returns false (cache miss) if the cache is disabled, or if any file is
+//! missing or does not match the shape of vars/scalars on any rank.  In this case vars
+//! are not modified.
+
+bool InitialDataCache::Load(const std::vector<DvceArray5D<Real>> &vars,
+                            std::vector<Real> &scalars) {
+  if (!enabled) return false;
+
+  // root checks snapshot is complete (meta file written last by Save) and reads scalars
+  int nscal = static_cast<int>(scalars.size());
+  int ok = 0;
+  if (global_variable::my_rank == 0) {
+    std::FILE *fp = std::fopen((path + "/meta.bin").c_str(), "rb");
+    if (fp != nullptr) {
+      std::uint64_t hdr[2];
+      int n = -1;
+      if (std::fread(hdr, sizeof(hdr), 1, fp) == 1 && hdr[0] == kMagic && hdr[1] == key &&
+          std::fread(&n, sizeof(int), 1, fp) == 1 && n == nscal &&
+          (nscal == 0 || std::fread(scalars.data(), sizeof(Real), nscal, fp) ==
+                         static_cast<std::size_t>(nscal))) {
+        ok = 1;
+      }
+      std::fclose(fp);
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Bcast(&ok, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  if (ok && nscal > 0) {
+    MPI_Bcast(scalars.data(), nscal, MPI_ATHENA_REAL, 0, MPI_COMM_WORLD);
+  }
+#endif
+  if (!ok) {
+    if (global_variable::my_rank == 0) {
+      std::cout << "Initial data cache miss, snapshot will be written to " << path
+                << std::endl;
+    }
+    return false;
+  }
+
+  // each rank reads its own MeshBlocks, in parallel on the host
+  auto pmbp = pmy_mesh->pmb_pack;
+  int nmb = pmbp->nmb_thispack;
+  int nvar = static_cast<int>(vars.size());
+  std::vector<DvceArray5D<Real>::HostMirror> host_vars;
+  for (auto &v : vars) {
+    host_vars.push_back(Kokkos::create_mirror_view(v));
+  }
+  int nfail = 0;
+  Kokkos::parallel_reduce("id_cache_read",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nmb),
+      [&](const int m, int &nf) {
+    std::FILE *fp = std::fopen(MeshBlockFileName(pmbp->gids + m).c_str(), "rb");
+    if (fp == nullptr) {nf++; return;}
+    std::uint64_t hdr[2];
+    int n = -1;
+    bool good = (std::fread(hdr, sizeof(hdr), 1, fp) == 1 && hdr[0] == kMagic &&
+                 hdr[1] == key && std::fread(&n, sizeof(int), 1, fp) == 1 && n == nvar);
+    for (int v=0; v<nvar && good; ++v) {
+      auto &h = host_vars[v];
+      int ext[4] = {0, 0, 0, 0};
+      good = (std::fread(ext, sizeof(ext), 1, fp) == 1 &&
+              ext[0] == static_cast<int>(h.extent(1)) &&
+              ext[1] == static_cast<int>(h.extent(2)) &&
+              ext[2] == static_cast<int>(h.extent(3)) &&
+              ext[3] == static_cast<int>(h.extent(4)));
+      std::size_t len = h.extent(1)*h.extent(2)*h.extent(3)*h.extent(4);
+      good = good && (std::fread(&h(m,0,0,0,0), sizeof(Real), len, fp) == len);
+    }
+    std::fclose(fp);
+    if (!good) nf++;
+  }, nfail);
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &nfail, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if (nfail > 0) {
+    if (global_variable::my_rank == 0) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << nfail << " MeshBlock snapshots in initial data cache " << path
+                << " are missing or corrupt, initial data will be recomputed"
+                << std::endl;
+    }
+    return false;
+  }
+  for (int v=0; v<nvar; ++v) {
+    Kokkos::deep_copy(vars[v], host_vars[v]);
+  }
+  if (global_variable::my_rank == 0) {
+    std::cout << "Initial data read from cache " << path << std::endl;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void InitialDataCache::Save()
+//! \brief Writes snapshot of arrays in vars for each MeshBlock on this rank (in parallel
+//! on the host), and the scalars.  The meta file containing the scalars is written by
+//! root only after all ranks have written their MeshBlocks successfully, so interrupted
+//! or failed writes are never mistaken for a complete snapshot.  Failure to write the
+//! cache is not fatal.
+
+void InitialDataCache::Save(const std::vector<DvceArray5D<Real>> &vars,
+                            const std::vector<Real> &scalars) {
+  if (!enabled) return;
+
+  // root creates directories
+  if (global_variable::my_rank == 0) {
+    std::string dir = path.substr(0, path.find_last_of('/'));
+    mkdir(dir.c_str(), 0775);
+    mkdir(path.c_str(), 0775);
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+  auto pmbp = pmy_mesh->pmb_pack;
+  int nmb = pmbp->nmb_thispack;
+  int nvar = static_cast<int>(vars.size());
+  std::vector<DvceArray5D<Real>::HostMirror> host_vars;
+  for (auto &v : vars) {
+    host_vars.push_back(Kokkos::create_mirror_view(v));
+    Kokkos::deep_copy(host_vars.back(), v);
+  }
+  int nfail = 0;
+  Kokkos::parallel_reduce("id_cache_write",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nmb),
+      [&](const int m, int &nf) {
+    std::FILE *fp = std::fopen(MeshBlockFileName(pmbp->gids + m).c_str(), "wb");
+    if (fp == nullptr) {nf++; return;}
+    std::uint64_t hdr[2] = {kMagic, key};
+    bool good = (std::fwrite(hdr, sizeof(hdr), 1, fp) == 1 &&
+                 std::fwrite(&nvar, sizeof(int), 1, fp) == 1);
+    for (int v=0; v<nvar && good; ++v) {
+      auto &h = host_vars[v];
+      int ext[4] = {static_cast<int>(h.extent(1)), static_cast<int>(h.extent(2)),
+                    static_cast<int>(h.extent(3)), static_cast<int>(h.extent(4))};
+      std::size_t len = h.extent(1)*h.extent(2)*h.extent(3)*h.extent(4);
+      good = (std::fwrite(ext, sizeof(ext), 1, fp) == 1 &&
+              std::fwrite(&h(m,0,0,0,0), sizeof(Real), len, fp) == len);
+    }
+    if (std::fclose(fp) != 0 || !good) nf++;
+  }, nfail);
+#if MPI_PARALLEL_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE, &nfail, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  if (global_variable::my_rank == 0) {
+    if (nfail > 0) {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "Could not write " << nfail << " MeshBlock snapshots to initial data "
+                << "cache " << path << std::endl;
+      return;
+    }
+    std::string tmp = path + "/meta.bin.tmp";
+    std::FILE *fp = std::fopen(tmp.c_str(), "wb");
+    bool good = (fp != nullptr);
+    if (good) {
+      std::uint64_t hdr[2] = {kMagic, key};
+      int nscal = static_cast<int>(scalars.size());
+      good = (std::fwrite(hdr, sizeof(hdr), 1, fp) == 1 &&
+              std::fwrite(&nscal, sizeof(int), 1, fp) == 1 &&
+              (nscal == 0 || std::fwrite(scalars.data(), sizeof(Real), nscal, fp) ==
+                             static_cast<std::size_t>(nscal)));
+      good = (std::fclose(fp) == 0) && good;
+    }
+    if (good) {
+      good = (std::rename(tmp.c_str(), (path + "/meta.bin").c_str()) == 0);
+    }
+    if (good) {
+      std::cout << "Initial data written to cache " << path << std::endl;
+    } else {
+      std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+                << "Could not write initial data cache " << path << std::endl;
+    }
+  }
+  return;
+}
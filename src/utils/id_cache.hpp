@@ -0,0 +1,54 @@
+#ifndef UTILS_ID_CACHE_HPP_
+#define UTILS_ID_CACHE_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file id_cache.hpp
+//! \brief definitions for InitialDataCache class, which stores the result of importing
+//! initial data from external solvers/files (LORENE, Elliptica, SGRID, Kadath,
+//! TwoPunctures, TOV, ...) as one binary snapshot per MeshBlock, so that later runs with
+//! the same initial data and mesh can skip the (expensive) interpolation step.
+//!
+//! The cache is enabled by setting <problem>/id_cache_dir.  Snapshots are stored in
+//! id_cache_dir/<key>/, where the key is a 64-bit hash of the initial data file, the
+//! parameters in the input blocks that control the import, and the mesh description
+//! (mesh size, cells per MeshBlock, number of ghost zones, and logical location of every
+//! MeshBlock).  Since snapshots are stored per gid, the number of ranks may change
+//! between the run that writes and the runs that read the cache.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+
+// Forward declarations
+class Mesh;
+class ParameterInput;
+
+//----------------------------------------------------------------------------------------
+//! \class InitialDataCache
+
+class InitialDataCache {
+ public:
+  InitialDataCache(ParameterInput *pin, Mesh *pm, const std::string &id_file,
+                   const std::vector<std::string> &blocks);
+  ~InitialDataCache() = default;
+
+  bool enabled;          // true if <problem>/id_cache_dir is set
+  std::uint64_t key;     // hash of initial data file, parameters, and mesh
+  std::string path;      // directory containing snapshots for this key
+
+  // functions: both must be called by all ranks
+  bool Load(const std::vector<DvceArray5D<Real>> &vars, std::vector<Real> &scalars);
+  void Save(const std::vector<DvceArray5D<Real>> &vars,
+            const std::vector<Real> &scalars);
+
+ private:
+  Mesh *pmy_mesh;
+  std::string MeshBlockFileName(int gid) const;
+};
+
+#endif // UTILS_ID_CACHE_HPP_
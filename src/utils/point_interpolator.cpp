@@ -0,0 +1,267 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file point_interpolator.cpp
+//! \brief implements functions in PointInterpolator class
+
+// C/C++ headers
+#include <algorithm> // fill
+#include <cmath>
+#include <utility>
+#include <vector>
+
+// AthenaK headers
+#include "athena.hpp"
+#include "globals.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "point_interpolator.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+// constructor, initializes data structures.  Coordinates of points must be stored in
+// pos by the user, before calling SetIndicesAndWeights().
+
+PointInterpolator::PointInterpolator(MeshBlockPack *pmbp, int n) :
+    npts(n),
+    nowned(0),
+    pos("interp_pos",n,3),
+    owned_pt("owned_pt",1),
+    owned_indcs("owned_indcs",1,1),
+    owned_wghts("owned_wghts",1,1,1),
+    owned_vals("owned_vals",1,1),
+    pmy_pack(pmbp),
+    nmb_changed_(0),
+    nvars_(0) {
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void PointInterpolator::SetIndicesAndWeights
+//! \brief Finds points located in MeshBlocks on this rank, and stores MeshBlock and zone
+//! indices and Lagrange interpolation weights for these points in compact arrays.  Must
+//! be called by all ranks, since ranks also send indices of owned points to root.
+
+void PointInterpolator::SetIndicesAndWeights() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  auto &size = pmy_pack->pmb->mb_size;
+  int &ng = indcs.ng;
+  int nmb = pmy_pack->nmb_thispack;
+
+  // find MeshBlock containing each point.  If point is on boundary between MeshBlocks,
+  // last MeshBlock containing point is used (as in SphericalSurface and CartesianGrid)
+  std::vector<int> pt_mb(npts, -1);
+  for (int p=0; p<npts; ++p) {
+    for (int m=0; m<nmb; ++m) {
+      if ((pos(p,0) >= size.h_view(m).x1min && pos(p,0) <= size.h_view(m).x1max) &&
+          (pos(p,1) >= size.h_view(m).x2min && pos(p,1) <= size.h_view(m).x2max) &&
+          (pos(p,2) >= size.h_view(m).x3min && pos(p,2) <= size.h_view(m).x3max)) {
+        pt_mb[p] = m;
+      }
+    }
+  }
+  nowned = 0;
+  for (int p=0; p<npts; ++p) {
+    if (pt_mb[p] >= 0) nowned++;
+  }
+
+  // allocate compact arrays (with at least one element)
+  int nalloc = std::max(nowned, 1);
+  Kokkos::realloc(owned_pt, nalloc);
+  Kokkos::realloc(owned_indcs, nalloc, 4);
+  Kokkos::realloc(owned_wghts, nalloc, 2*ng, 3);
+
+  int q = 0;
+  for (int p=0; p<npts; ++p) {
+    int m = pt_mb[p];
+    if (m < 0) continue;
+    Real x[3] = {pos(p,0), pos(p,1), pos(p,2)};
+    Real xmin[3] = {size.h_view(m).x1min, size.h_view(m).x2min, size.h_view(m).x3min};
+    Real xmax[3] = {size.h_view(m).x1max, size.h_view(m).x2max, size.h_view(m).x3max};
+    Real dx[3] = {size.h_view(m).dx1, size.h_view(m).dx2, size.h_view(m).dx3};
+    int nx[3] = {indcs.nx1, indcs.nx2, indcs.nx3};
+
+    owned_pt.h_view(q) = p;
+    owned_indcs.h_view(q,0) = m;
+    for (int d=0; d<3; ++d) {
+      // index of zone to left of point (on interior grid)
+      int ii = static_cast<int>(std::floor((x[d] - (xmin[d] + dx[d]/2.0))/dx[d]));
+      owned_indcs.h_view(q,d+1) = ii;
+      // Lagrange interpolation weights in each direction
+      for (int i=0; i<2*ng; ++i) {
+        owned_wghts.h_view(q,i,d) = 1.0;
+        Real xi = CellCenterX(ii-ng+i+1, nx[d], xmin[d], xmax[d]);
+        for (int j=0; j<2*ng; ++j) {
+          if (j != i) {
+            Real xj = CellCenterX(ii-ng+j+1, nx[d], xmin[d], xmax[d]);
+            owned_wghts.h_view(q,i,d) *= (x[d] - xj)/(xi - xj);
+          }
+        }
+      }
+    }
+    q++;
+  }
+
+  // sync dual arrays
+  owned_pt.template modify<HostMemSpace>();
+  owned_pt.template sync<DevExeSpace>();
+  owned_indcs.template modify<HostMemSpace>();
+  owned_indcs.template sync<DevExeSpace>();
+  owned_wghts.template modify<HostMemSpace>();
+  owned_wghts.template sync<DevExeSpace>();
+
+  // collect number and indices of points owned by each rank on root
+  int nranks = global_variable::nranks;
+  nowned_eachrank_.assign(nranks, 0);
+  displ_eachrank_.assign(nranks, 0);
+#if MPI_PARALLEL_ENABLED
+  MPI_Gather(&nowned, 1, MPI_INT, nowned_eachrank_.data(), 1, MPI_INT, 0,
+             MPI_COMM_WORLD);
+#else
+  nowned_eachrank_[0] = nowned;
+#endif
+  int ntot = 0;
+  for (int r=0; r<nranks; ++r) {
+    displ_eachrank_[r] = ntot;
+    ntot += nowned_eachrank_[r];
+  }
+  pt_eachrank_.assign(std::max(ntot, 1), 0);
+#if MPI_PARALLEL_ENABLED
+  MPI_Gatherv(owned_pt.h_view.data(), nowned, MPI_INT, pt_eachrank_.data(),
+              nowned_eachrank_.data(), displ_eachrank_.data(), MPI_INT, 0,
+              MPI_COMM_WORLD);
+#else
+  for (int n=0; n<nowned; ++n) {pt_eachrank_[n] = owned_pt.h_view(n);}
+#endif
+
+  // save number of MeshBlocks created and deleted by AMR, used to detect mesh changes
+  if (pmy_pack->pmesh->adaptive) {
+    nmb_changed_ = pmy_pack->pmesh->pmr->nmb_created + pmy_pack->pmesh->pmr->nmb_deleted;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void PointInterpolator::Interpolate
+//! \brief Interpolates list of variables (given as pairs of device array and index of
+//! variable in that array) to all points owned by this rank.  Variables stored in the
+//! same device array are interpolated in one kernel.  Results are stored in owned_vals
+//! (and copied to host).  Indices and weights are recomputed if mesh changed with AMR.
+
+void PointInterpolator::Interpolate(
+    const std::vector<std::pair<DvceArray5D<Real>*, int>> &vars) {
+  auto *pmesh = pmy_pack->pmesh;
+  if (pmesh->adaptive &&
+      (pmesh->pmr->nmb_created + pmesh->pmr->nmb_deleted != nmb_changed_)) {
+    SetIndicesAndWeights();
+  }
+
+  nvars_ = vars.size();
+  if (static_cast<int>(owned_vals.extent(0)) != std::max(nowned, 1) ||
+      static_cast<int>(owned_vals.extent(1)) != std::max(nvars_, 1)) {
+    Kokkos::realloc(owned_vals, std::max(nowned, 1), std::max(nvars_, 1));
+  }
+
+  // capturing variables for kernel
+  auto &indcs = pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  int ng = indcs.ng;
+  int nown1 = nowned - 1;
+  auto &iindcs = owned_indcs;
+  auto &iwghts = owned_wghts;
+  auto &ivals = owned_vals;
+
+  // group variables by device array, and launch one kernel per array
+  std::vector<bool> done(nvars_, false);
+  for (int n=0; n<nvars_; ++n) {
+    if (done[n]) continue;
+    std::vector<int> cols;
+    for (int l=n; l<nvars_; ++l) {
+      if (vars[l].first == vars[n].first) {
+        cols.push_back(l);
+        done[l] = true;
+      }
+    }
+    int nv = cols.size();
+    DualArray2D<int> vmap("vmap", nv, 2);  // index in array, column in owned_vals
+    for (int l=0; l<nv; ++l) {
+      vmap.h_view(l,0) = vars[cols[l]].second;
+      vmap.h_view(l,1) = cols[l];
+    }
+    vmap.template modify<HostMemSpace>();
+    vmap.template sync<DevExeSpace>();
+
+    auto val = *(vars[n].first);
+    par_for("interp_pts",DevExeSpace(),0,(nv-1),0,nown1,
+    KOKKOS_LAMBDA(int v, int q) {
+      int m   = iindcs.d_view(q,0);
+      int ii1 = iindcs.d_view(q,1);
+      int ii2 = iindcs.d_view(q,2);
+      int ii3 = iindcs.d_view(q,3);
+      int iv  = vmap.d_view(v,0);
+      Real int_value = 0.0;
+      for (int i=0; i<2*ng; i++) {
+        for (int j=0; j<2*ng; j++) {
+          for (int k=0; k<2*ng; k++) {
+            Real iwght = iwghts.d_view(q,i,0)*iwghts.d_view(q,j,1)*iwghts.d_view(q,k,2);
+            int_value += iwght*val(m,iv,ii3-(ng-k-ks)+1,ii2-(ng-j-js)+1,ii1-(ng-i-is)+1);
+          }
+        }
+      }
+      ivals.d_view(q,vmap.d_view(v,1)) = int_value;
+    });
+  }
+
+  // sync dual arrays
+  owned_vals.template modify<DevExeSpace>();
+  owned_vals.template sync<HostMemSpace>();
+
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void PointInterpolator::GatherToRoot
+//! \brief Sends values interpolated at points owned by each rank to root rank (using
+//! MPI_Gatherv), and stores them in out[v*npts + p] for variable v and point p. Must
+//! be called by all ranks after Interpolate().  Points not owned by any rank are zero.
+
+void PointInterpolator::GatherToRoot(Real *out) {
+  int nv = nvars_;
+  bool root = (global_variable::my_rank == 0);
+  if (root) {
+    std::fill(out, out + nv*npts, 0.0);
+  }
+#if MPI_PARALLEL_ENABLED
+  int nranks = global_variable::nranks;
+  std::vector<int> counts(nranks), displs(nranks);
+  for (int r=0; r<nranks; ++r) {
+    counts[r] = nv*nowned_eachrank_[r];
+    displs[r] = nv*displ_eachrank_[r];
+  }
+  int nrecv = root ? nv*static_cast<int>(pt_eachrank_.size()) : 1;
+  std::vector<Real> recv(std::max(nrecv, 1));
+  MPI_Gatherv(owned_vals.h_view.data(), nv*nowned, MPI_ATHENA_REAL, recv.data(),
+              counts.data(), displs.data(), MPI_ATHENA_REAL, 0, MPI_COMM_WORLD);
+  if (root) {
+    int ntot = displ_eachrank_[nranks-1] + nowned_eachrank_[nranks-1];
+    for (int q=0; q<ntot; ++q) {
+      int p = pt_eachrank_[q];
+      for (int v=0; v<nv; ++v) {
+        out[v*npts + p] = recv[q*nv + v];
+      }
+    }
+  }
+#else
+  for (int q=0; q<nowned; ++q) {
+    int p = owned_pt.h_view(q);
+    for (int v=0; v<nv; ++v) {
+      out[v*npts + p] = owned_vals.h_view(q,v);
+    }
+  }
+#endif
+  return;
+}
@@ -0,0 +1,55 @@
+#ifndef UTILS_POINT_INTERPOLATOR_HPP_
+#define UTILS_POINT_INTERPOLATOR_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file point_interpolator.hpp
+//! \brief definitions for PointInterpolator class, which interpolates many cell-centered
+//! variables to an arbitrary set of points (e.g. a SphericalSurface or CartesianGrid) in
+//! a single kernel, and collects the results on the root rank.
+//!
+//! Only points located in MeshBlocks on this rank are stored (in compact arrays), so the
+//! work done by the kernel and the data sent to the root rank is proportional to the
+//! number of points owned by the rank rather than the total number of points.  Indices
+//! and weights are computed once, and only recomputed when the mesh changes with AMR.
+
+#include <utility>
+#include <vector>
+
+#include "athena.hpp"
+
+// Forward declarations
+class MeshBlockPack;
+
+//----------------------------------------------------------------------------------------
+//! \class PointInterpolator
+
+class PointInterpolator {
+ public:
+  PointInterpolator(MeshBlockPack *pmy_pack, int npts);
+  ~PointInterpolator() = default;
+
+  int npts;                       // total number of points (on all ranks)
+  int nowned;                     // number of points in MeshBlocks on this rank
+  HostArray2D<Real> pos;          // (npts,3) Cartesian coordinates of points
+  DualArray1D<int> owned_pt;      // index in [0,npts) of each point owned by this rank
+  DualArray2D<int> owned_indcs;   // (nowned,4) MeshBlock and zone indices for interp
+  DualArray3D<Real> owned_wghts;  // (nowned,2*ng,3) weights for Lagrange interpolation
+  DualArray2D<Real> owned_vals;   // (nowned,nvars) data interpolated to owned points
+
+  // functions
+  void SetIndicesAndWeights();    // must be called after pos is set by user
+  void Interpolate(const std::vector<std::pair<DvceArray5D<Real>*, int>> &vars);
+  void GatherToRoot(Real *out);   // out dimensioned [nvars*npts] on root rank
+
+ private:
+  MeshBlockPack *pmy_pack;    // ptr to MeshBlockPack containing this PointInterpolator
+  int nmb_changed_;           // number of MBs created+deleted by AMR at last update
+  int nvars_;                 // number of variables in last call to Interpolate()
+  std::vector<int> nowned_eachrank_, displ_eachrank_;  // used on root rank only
+  std::vector<int> pt_eachrank_;  // indices of points owned by all ranks (root only)
+};
+
+#endif // UTILS_POINT_INTERPOLATOR_HPP_
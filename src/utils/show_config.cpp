@@ -22,6 +22,9 @@ void ShowConfig() {
   } else {
     std::cout<<"  Floating-point precision:   double" << std::endl;
   }
+  if (RAD_MIXED_PRECISION_ENABLED) {
+    std::cout<<"  Radiation storage:          single (mixed precision)" << std::endl;
+  }
 #if MPI_PARALLEL_ENABLED
   std::cout<<"  MPI parallelism:            ON" << std::endl;
 #else
@@ -30,9 +30,16 @@ Tmunu::Tmunu(MeshBlockPack *ppack, ParameterInput *pin):
   int ncells3 = (indcs.nx3 > 1) ? (indcs.nx3 + 2*(indcs.ng)) : 1;
 
   Kokkos::realloc(u_tmunu, nmb, N_Tmunu, ncells3, ncells2, ncells1);
-  tmunu.S_dd.InitWithShallowSlice(u_tmunu, I_Tmunu_Sxx, I_Tmunu_Szz);
-  tmunu.E.InitWithShallowSlice(u_tmunu, I_Tmunu_E);
-  tmunu.S_d.InitWithShallowSlice(u_tmunu, I_Tmunu_Sx, I_Tmunu_Sz);
+  auto set_slices = [this]() {
+    tmunu.S_dd.InitWithShallowSlice(u_tmunu, I_Tmunu_Sxx, I_Tmunu_Szz);
+    tmunu.E.InitWithShallowSlice(u_tmunu, I_Tmunu_E);
+    tmunu.S_d.InitWithShallowSlice(u_tmunu, I_Tmunu_Sx, I_Tmunu_Sz);
+  };
+  set_slices();
+
+  // slices must be reset whenever u_tmunu is resized by MeshBlockPool with AMR
+  ppack->pmesh->pmb_pool->Register(u_tmunu);
+  ppack->pmesh->pmb_pool->RegisterFunction([set_slices](int n) {set_slices();});
 }
 
 Tmunu::~Tmunu() {}
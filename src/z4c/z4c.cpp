@@ -24,6 +24,7 @@
 #include "z4c/horizon_dump.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
+#include "z4c/z4c_update.hpp"
 #include "coordinates/adm.hpp"
 #include "utils/cart_grid.hpp"
 
@@ -88,37 +89,47 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   Kokkos::realloc(u_rhs, nmb, (nz4c), ncells3, ncells2, ncells1);
   Kokkos::realloc(u_weyl,    nmb, (2), ncells3, ncells2, ncells1);
 
-  con.C.InitWithShallowSlice(u_con, I_CON_C);
-  con.H.InitWithShallowSlice(u_con, I_CON_H);
-  con.M.InitWithShallowSlice(u_con, I_CON_M);
-  con.Z.InitWithShallowSlice(u_con, I_CON_Z);
-  con.M_d.InitWithShallowSlice(u_con, I_CON_MX, I_CON_MZ);
-
-  // Matter commented out
-  //mat.rho.InitWithShallowSlice(u_mat, I_MAT_rho);
-  //mat.S_d.InitWithShallowSlice(u_mat, I_MAT_Sx, I_MAT_Sz);
-  //mat.S_dd.InitWithShallowSlice(u_mat, I_MAT_Sxx, I_MAT_Szz);
-
-  z4c.alpha.InitWithShallowSlice (u0, I_Z4C_ALPHA);
-  z4c.beta_u.InitWithShallowSlice(u0, I_Z4C_BETAX, I_Z4C_BETAZ);
-  z4c.chi.InitWithShallowSlice   (u0, I_Z4C_CHI);
-  z4c.vKhat.InitWithShallowSlice  (u0, I_Z4C_KHAT);
-  z4c.vTheta.InitWithShallowSlice (u0, I_Z4C_THETA);
-  z4c.vGam_u.InitWithShallowSlice (u0, I_Z4C_GAMX, I_Z4C_GAMZ);
-  z4c.g_dd.InitWithShallowSlice  (u0, I_Z4C_GXX, I_Z4C_GZZ);
-  z4c.vA_dd.InitWithShallowSlice  (u0, I_Z4C_AXX, I_Z4C_AZZ);
-
-  rhs.alpha.InitWithShallowSlice (u_rhs, I_Z4C_ALPHA);
-  rhs.beta_u.InitWithShallowSlice(u_rhs, I_Z4C_BETAX, I_Z4C_BETAZ);
-  rhs.chi.InitWithShallowSlice   (u_rhs, I_Z4C_CHI);
-  rhs.vKhat.InitWithShallowSlice  (u_rhs, I_Z4C_KHAT);
-  rhs.vTheta.InitWithShallowSlice (u_rhs, I_Z4C_THETA);
-  rhs.vGam_u.InitWithShallowSlice (u_rhs, I_Z4C_GAMX, I_Z4C_GAMZ);
-  rhs.g_dd.InitWithShallowSlice  (u_rhs, I_Z4C_GXX, I_Z4C_GZZ);
-  rhs.vA_dd.InitWithShallowSlice  (u_rhs, I_Z4C_AXX, I_Z4C_AZZ);
-
-  weyl.rpsi4.InitWithShallowSlice (u_weyl, 0);
-  weyl.ipsi4.InitWithShallowSlice (u_weyl, 1);
+  auto set_slices = [this]() {
+    con.C.InitWithShallowSlice(u_con, I_CON_C);
+    con.H.InitWithShallowSlice(u_con, I_CON_H);
+    con.M.InitWithShallowSlice(u_con, I_CON_M);
+    con.Z.InitWithShallowSlice(u_con, I_CON_Z);
+    con.M_d.InitWithShallowSlice(u_con, I_CON_MX, I_CON_MZ);
+
+    // Matter commented out
+    //mat.rho.InitWithShallowSlice(u_mat, I_MAT_rho);
+    //mat.S_d.InitWithShallowSlice(u_mat, I_MAT_Sx, I_MAT_Sz);
+    //mat.S_dd.InitWithShallowSlice(u_mat, I_MAT_Sxx, I_MAT_Szz);
+
+    z4c.alpha.InitWithShallowSlice (u0, I_Z4C_ALPHA);
+    z4c.beta_u.InitWithShallowSlice(u0, I_Z4C_BETAX, I_Z4C_BETAZ);
+    z4c.chi.InitWithShallowSlice   (u0, I_Z4C_CHI);
+    z4c.vKhat.InitWithShallowSlice  (u0, I_Z4C_KHAT);
+    z4c.vTheta.InitWithShallowSlice (u0, I_Z4C_THETA);
+    z4c.vGam_u.InitWithShallowSlice (u0, I_Z4C_GAMX, I_Z4C_GAMZ);
+    z4c.g_dd.InitWithShallowSlice  (u0, I_Z4C_GXX, I_Z4C_GZZ);
+    z4c.vA_dd.InitWithShallowSlice  (u0, I_Z4C_AXX, I_Z4C_AZZ);
+
+    rhs.alpha.InitWithShallowSlice (u_rhs, I_Z4C_ALPHA);
+    rhs.beta_u.InitWithShallowSlice(u_rhs, I_Z4C_BETAX, I_Z4C_BETAZ);
+    rhs.chi.InitWithShallowSlice   (u_rhs, I_Z4C_CHI);
+    rhs.vKhat.InitWithShallowSlice  (u_rhs, I_Z4C_KHAT);
+    rhs.vTheta.InitWithShallowSlice (u_rhs, I_Z4C_THETA);
+    rhs.vGam_u.InitWithShallowSlice (u_rhs, I_Z4C_GAMX, I_Z4C_GAMZ);
+    rhs.g_dd.InitWithShallowSlice  (u_rhs, I_Z4C_GXX, I_Z4C_GZZ);
+    rhs.vA_dd.InitWithShallowSlice  (u_rhs, I_Z4C_AXX, I_Z4C_AZZ);
+
+    weyl.rpsi4.InitWithShallowSlice (u_weyl, 0);
+    weyl.ipsi4.InitWithShallowSlice (u_weyl, 1);
+  };
+  set_slices();
+  ppack->pmesh->pmb_pool->Register(u_con);
+  ppack->pmesh->pmb_pool->Register(u0);
+  ppack->pmesh->pmb_pool->Register(u1);
+  ppack->pmesh->pmb_pool->Register(u_rhs);
+  ppack->pmesh->pmb_pool->Register(u_weyl);
+  // slices must be reset whenever arrays are resized by MeshBlockPool with AMR
+  ppack->pmesh->pmb_pool->RegisterFunction([set_slices](int n) {set_slices();});
 
   opt.chi_psi_power = pin->GetOrAddReal("z4c", "chi_psi_power", -4.0);
   opt.chi_div_floor = pin->GetOrAddReal("z4c", "chi_div_floor", -1000.0);
@@ -153,6 +164,22 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
   opt.extrap_order = fmax(2,fmin(indcs.ng,fmin(4,
       pin->GetOrAddInteger("z4c", "extrap_order", 2))));
 
+  // cache-blocked RHS, tiles default to full rows in x1 and 4x4 cells in x2/x3
+  opt.rhs_tiled = pin->GetOrAddBoolean("z4c", "rhs_tiled", false);
+  opt.rhs_tile_nx1 = pin->GetOrAddInteger("z4c", "rhs_tile_nx1", indcs.nx1);
+  opt.rhs_tile_nx2 = pin->GetOrAddInteger("z4c", "rhs_tile_nx2", 4);
+  opt.rhs_tile_nx3 = pin->GetOrAddInteger("z4c", "rhs_tile_nx3", 4);
+  opt.rhs_scratch_level = pin->GetOrAddInteger("z4c", "rhs_scratch_level", 1);
+  if (opt.rhs_tile_nx1 < 1 || opt.rhs_tile_nx2 < 1 || opt.rhs_tile_nx3 < 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<z4c>/rhs_tile_nx1,2,3 must be positive" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // fused dissipation/update/constraint/ADM kernels (the unfused path is kept for
+  // debugging)
+  opt.fused_update = pin->GetOrAddBoolean("z4c", "fused_update", false);
+
   diss = opt.diss*pow(2., -2.*indcs.ng)*(indcs.ng % 2 == 0 ? -1. : 1.);
   }
 
@@ -164,6 +191,8 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
     int nccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_u0, nmb, (nz4c), nccells3, nccells2, nccells1);
     Kokkos::realloc(coarse_u_weyl, nmb, (2), nccells3, nccells2, nccells1);
+    ppack->pmesh->pmb_pool->Register(coarse_u0);
+    ppack->pmesh->pmb_pool->Register(coarse_u_weyl);
   }
   Kokkos::Profiling::popRegion();
 
@@ -243,11 +272,12 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn void Z4c::AlgConstr(AthenaArray<Real> & u)
+//! \fn void Z4c::AlgConstr(MeshBlockPack *pmbp, bool ghosts_only)
 //! \brief algebraic constraints projection
 //
-// This function operates on all grid points of the MeshBlock
-void Z4c::AlgConstr(MeshBlockPack *pmbp) {
+// This function operates on all grid points of the MeshBlock, or only on the ghost zones
+// if ghosts_only is true (the interior is then constrained by the fused RK update).
+void Z4c::AlgConstr(MeshBlockPack *pmbp, bool ghosts_only) {
   // capture variables for the kernel
   auto &indcs = pmbp->pmesh->mb_indcs;
   int &is = indcs.is; int &ie = indcs.ie;
@@ -264,32 +294,23 @@ void Z4c::AlgConstr(MeshBlockPack *pmbp) {
   par_for("Alg constr loop",DevExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    Real detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
-                              z4c.g_dd(m,0,2,k,j,i),z4c.g_dd(m,1,1,k,j,i),
-                              z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i));
-    detg = detg > 0. ? detg : 1.;
-    // Real eps = detg - 1.;
-    // Real oopsi4 = (eps < opt.eps_floor) ? (1. - opt.eps_floor/3.) :
-    //             (std::pow(1./detg, 1./3.));
-    Real oopsi4 = std::cbrt(1./detg);
-
-    for(int a = 0; a < 3; ++a)
-    for(int b = a; b < 3; ++b) {
-      z4c.g_dd(m,a,b,k,j,i) *= oopsi4;
+    if (ghosts_only && (k >= ks && k <= ke) && (j >= js && j <= je) &&
+        (i >= is && i <= ie)) {
+      return;
+    }
+    Real g_dd[6], A_dd[6];
+    for(int a = 0, ab = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b, ++ab) {
+      g_dd[ab] = z4c.g_dd(m,a,b,k,j,i);
+      A_dd[ab] = z4c.vA_dd(m,a,b,k,j,i);
     }
 
-    // compute trace of A
-    // note: here we are assuming that det g = 1, which we enforced above
-    Real A = adm::Trace(1.0,
-              z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i), z4c.g_dd(m,0,2,k,j,i),
-              z4c.g_dd(m,1,1,k,j,i), z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i),
-              z4c.vA_dd(m,0,0,k,j,i), z4c.vA_dd(m,0,1,k,j,i), z4c.vA_dd(m,0,2,k,j,i),
-              z4c.vA_dd(m,1,1,k,j,i), z4c.vA_dd(m,1,2,k,j,i), z4c.vA_dd(m,2,2,k,j,i));
-
-    // enforce trace of A to be zero
-    for(int a = 0; a < 3; ++a)
-    for(int b = a; b < 3; ++b) {
-      z4c.vA_dd(m,a,b,k,j,i) -= (1.0/3.0) * A * z4c.g_dd(m,a,b,k,j,i);
+    Z4cAlgConstrPoint(g_dd, A_dd);
+
+    for(int a = 0, ab = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b, ++ab) {
+      z4c.g_dd(m,a,b,k,j,i) = g_dd[ab];
+      z4c.vA_dd(m,a,b,k,j,i) = A_dd[ab];
     }
   });
 }
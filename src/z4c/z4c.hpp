@@ -176,6 +176,13 @@ class Z4c {
     int extrap_order;
     // Value of chi to specify the excision region for constraint evaluation
     Real excise_chi;
+    // Cache-blocked RHS: tile size (in cells) and scratch level
+    bool rhs_tiled;
+    int rhs_tile_nx1, rhs_tile_nx2, rhs_tile_nx3;
+    int rhs_scratch_level;
+    // Fuse K-O dissipation into the RHS kernel, and the algebraic constraints and ADM
+    // conversion of the interior into the RK update kernel
+    bool fused_update;
   };
   Options opt;
   Real diss;              // Dissipation parameter
@@ -237,15 +244,17 @@ class Z4c {
   template <int NGHOST>
   TaskStatus CalcRHS(Driver *d, int stage);
   template <int NGHOST>
+  void CalcRHSTiled();
+  template <int NGHOST>
   void ADMToZ4c(MeshBlockPack *pmbp, ParameterInput *pin);
   void GaugePreCollapsedLapse(MeshBlockPack *pmbp, ParameterInput *pin);
-  void Z4cToADM(MeshBlockPack *pmbp);
+  void Z4cToADM(MeshBlockPack *pmbp, bool ghosts_only=false);
   template <int NGHOST>
   void ADMConstraints(MeshBlockPack *pmbp);
   template <int NGHOST>
   void Z4cWeyl(MeshBlockPack *pmbp);
   void WaveExtr(MeshBlockPack *pmbp);
-  void AlgConstr(MeshBlockPack *pmbp);
+  void AlgConstr(MeshBlockPack *pmbp, bool ghosts_only=false);
 
   Z4c_AMR *pamr;
   std::vector<std::unique_ptr<CompactObjectTracker>> ptracker;
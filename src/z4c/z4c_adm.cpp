@@ -20,6 +20,7 @@
 #include "coordinates/adm.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/tmunu.hpp"
+#include "z4c/z4c_update.hpp"
 #include "coordinates/cell_locations.hpp"
 
 namespace z4c {
@@ -194,11 +195,12 @@ template void Z4c::ADMToZ4c<2>(MeshBlockPack *pmbp, ParameterInput *pin);
 template void Z4c::ADMToZ4c<3>(MeshBlockPack *pmbp, ParameterInput *pin);
 template void Z4c::ADMToZ4c<4>(MeshBlockPack *pmbp, ParameterInput *pin);
 //----------------------------------------------------------------------------------------
-//! \fn void Z4c::Z4cToADM(MeshBlockPack *pmbp)
+//! \fn void Z4c::Z4cToADM(MeshBlockPack *pmbp, bool ghosts_only)
 //! \brief Compute ADM Psi4, g_ij, and K_ij from Z4c variables
 //
-// This sets the ADM variables everywhere in the MeshBlock
-void Z4c::Z4cToADM(MeshBlockPack *pmbp) {
+// This sets the ADM variables everywhere in the MeshBlock, or only in the ghost zones if
+// ghosts_only is true (the interior is then set by the fused RK update).
+void Z4c::Z4cToADM(MeshBlockPack *pmbp, bool ghosts_only) {
   // capture variables for the kernel
   auto &indcs = pmbp->pmesh->mb_indcs;
   int &is = indcs.is; int &ie = indcs.ie;
@@ -213,23 +215,28 @@ void Z4c::Z4cToADM(MeshBlockPack *pmbp) {
 
   auto &z4c = pmbp->pz4c->z4c;
   auto &adm = pmbp->padm->adm;
-  auto &opt = pmbp->pz4c->opt;
+  Real chi_psi_power = pmbp->pz4c->opt.chi_psi_power;
   par_for("initialize z4c fields",DevExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    adm.psi4(m,k,j,i) = pow(z4c.chi(m,k,j,i), 4./opt.chi_psi_power);
-
-    // g_ab
-    for(int a = 0; a < 3; ++a)
-    for(int b = a; b < 3; ++b) {
-      adm.g_dd(m,a,b,k,j,i) = adm.psi4(m,k,j,i) * z4c.g_dd(m,a,b,k,j,i);
+    if (ghosts_only && (k >= ks && k <= ke) && (j >= js && j <= je) &&
+        (i >= is && i <= ie)) {
+      return;
+    }
+    Real g_dd[6], A_dd[6], adm_g_dd[6], adm_K_dd[6];
+    for(int a = 0, ab = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b, ++ab) {
+      g_dd[ab] = z4c.g_dd(m,a,b,k,j,i);
+      A_dd[ab] = z4c.vA_dd(m,a,b,k,j,i);
     }
 
-    // K_ab
-    for(int a = 0; a < 3; ++a)
-    for(int b = a; b < 3; ++b) {
-      adm.vK_dd(m,a,b,k,j,i) = adm.psi4(m,k,j,i) * z4c.vA_dd(m,a,b,k,j,i) +
-        (1./3.) * (z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i)) * adm.g_dd(m,a,b,k,j,i);
+    Z4cToADMPoint(chi_psi_power, z4c.chi(m,k,j,i), z4c.vKhat(m,k,j,i),
+                  z4c.vTheta(m,k,j,i), g_dd, A_dd, adm.psi4(m,k,j,i), adm_g_dd, adm_K_dd);
+
+    for(int a = 0, ab = 0; a < 3; ++a)
+    for(int b = a; b < 3; ++b, ++ab) {
+      adm.g_dd(m,a,b,k,j,i) = adm_g_dd[ab];
+      adm.vK_dd(m,a,b,k,j,i) = adm_K_dd[ab];
     }
   });
   return;
@@ -0,0 +1,602 @@
+#ifndef Z4C_Z4C_CALCRHS_HPP_
+#define Z4C_Z4C_CALCRHS_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file z4c_calcrhs.hpp
+//! \brief pointwise stages of the Z4c RHS, shared by the pointwise kernel in
+//! Z4c::CalcRHS and the cache-blocked kernel in Z4c::CalcRHSTiled.
+//!
+//! All functions are templated on the type used to access the Z4c variables, which is
+//! either Z4c::Z4c_vars (aliases into u0 in global memory) or Z4cTile (a brick of u0
+//! staged in team scratch memory).  Both are indexed with the global (m,k,j,i) indices.
+
+#include <math.h>
+
+#include "athena.hpp"
+#include "athena_tensor.hpp"
+#include "coordinates/adm.hpp"
+#include "utils/finite_diff.hpp"
+#include "z4c/z4c.hpp"
+#include "z4c/tmunu.hpp"
+
+namespace z4c {
+
+//----------------------------------------------------------------------------------------
+//! \struct Z4cDerivs
+//! \brief finite-difference derivatives of the Z4c variables needed by the RHS at a point
+
+struct Z4cDerivs {
+  // lapse, chi, Khat and Theta 1st drvts
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> dalpha_d;
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> dchi_d;
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> dKhat_d;
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> dTheta_d;
+  // shift and Gamma 1st drvts
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 2> dbeta_du;
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 2> dGam_du;
+  // metric 1st drvts
+  AthenaPointTensor<Real, TensorSymm::SYM2,  3, 3> dg_ddd;
+
+  // lapse and chi 2nd drvts
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> ddalpha_dd;
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> ddchi_dd;
+  // shift 2nd drvts
+  AthenaPointTensor<Real, TensorSymm::ISYM2, 3, 3> ddbeta_ddu;
+  // metric 2nd drvts
+  AthenaPointTensor<Real, TensorSymm::SYM22, 3, 4> ddg_dddd;
+
+  // auxiliary Lie derivatives along the shift vector
+  Real Lalpha, Lchi, LKhat, LTheta;
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> Lbeta_u;
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> LGam_u;
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> Lg_dd;
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> LA_dd;
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct Z4cTileField
+//! \brief accessor for one Z4c variable in a brick of u0 stored in team scratch memory.
+//! The brick holds variables [0,nz4c) over cells [ks,ks+nk) x [js,js+nj) x [is,is+ni),
+//! and n0 is the index of the first component of the variable.  The call operators match
+//! those of AthenaTensor of rank 0, 1 and 2 (symmetric), so the finite-difference
+//! templates in finite_diff.hpp can be applied to either.
+
+struct Z4cTileField {
+  ScrArray1D<Real> u;
+  int n0, nk, nj, ni, ks, js, is;
+
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const m, int const k, int const j, int const i) const {
+    return u(((n0*nk + (k - ks))*nj + (j - js))*ni + (i - is));
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const m, int const a, int const k, int const j, int const i) const {
+    return u((((n0 + a)*nk + (k - ks))*nj + (j - js))*ni + (i - is));
+  }
+  KOKKOS_INLINE_FUNCTION
+  Real operator()(int const m, int const a, int const b,
+                  int const k, int const j, int const i) const {
+    int const ab = (b < a) ? b*(7 - b)/2 + a - b : a*(7 - a)/2 + b - a;
+    return u((((n0 + ab)*nk + (k - ks))*nj + (j - js))*ni + (i - is));
+  }
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct Z4cTile
+//! \brief Z4c variables in a brick of u0 stored in team scratch memory, with the same
+//! member names as Z4c::Z4c_vars
+
+struct Z4cTile {
+  Z4cTileField chi, vKhat, vTheta, alpha, vGam_u, beta_u, g_dd, vA_dd;
+
+  KOKKOS_INLINE_FUNCTION
+  Z4cTile(const ScrArray1D<Real> &u, int nk, int nj, int ni, int ks, int js, int is) {
+    chi    = {u, Z4c::I_Z4C_CHI,   nk, nj, ni, ks, js, is};
+    vKhat  = {u, Z4c::I_Z4C_KHAT,  nk, nj, ni, ks, js, is};
+    vTheta = {u, Z4c::I_Z4C_THETA, nk, nj, ni, ks, js, is};
+    alpha  = {u, Z4c::I_Z4C_ALPHA, nk, nj, ni, ks, js, is};
+    vGam_u = {u, Z4c::I_Z4C_GAMX,  nk, nj, ni, ks, js, is};
+    beta_u = {u, Z4c::I_Z4C_BETAX, nk, nj, ni, ks, js, is};
+    g_dd   = {u, Z4c::I_Z4C_GXX,   nk, nj, ni, ks, js, is};
+    vA_dd  = {u, Z4c::I_Z4C_AXX,   nk, nj, ni, ks, js, is};
+  }
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4cFirstDerivs
+//! \brief 1st derivatives of the Z4c variables
+
+template <int NGHOST, typename Z4cT>
+KOKKOS_INLINE_FUNCTION
+void Z4cFirstDerivs(const Real idx[], const Z4cT &z4c,
+                    const int m, const int k, const int j, const int i, Z4cDerivs &d) {
+  // Scalars
+  for(int a = 0; a < 3; ++a) {
+    d.dalpha_d(a) = Dx<NGHOST>(a, idx, z4c.alpha, m,k,j,i);
+    d.dchi_d  (a) = Dx<NGHOST>(a, idx, z4c.chi,   m,k,j,i);
+    d.dKhat_d (a) = Dx<NGHOST>(a, idx, z4c.vKhat,  m,k,j,i);
+    d.dTheta_d(a) = Dx<NGHOST>(a, idx, z4c.vTheta, m,k,j,i);
+  }
+
+  // Vectors
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    d.dbeta_du(b,a) = Dx<NGHOST>(b, idx, z4c.beta_u, m,a,k,j,i);
+    d.dGam_du(b,a) = Dx<NGHOST>(b, idx, z4c.vGam_u,  m,a,k,j,i);
+  }
+
+  // Tensors
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b)
+  for(int c = 0; c < 3; ++c) {
+    d.dg_ddd(c,a,b) = Dx<NGHOST>(c, idx, z4c.g_dd, m,a,b,k,j,i);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4cSecondDerivs
+//! \brief 2nd derivatives of the Z4c variables
+
+template <int NGHOST, typename Z4cT>
+KOKKOS_INLINE_FUNCTION
+void Z4cSecondDerivs(const Real idx[], const Z4cT &z4c,
+                     const int m, const int k, const int j, const int i, Z4cDerivs &d) {
+  // Scalars
+  for(int a = 0; a < 3; ++a) {
+    d.ddalpha_dd(a,a) = Dxx<NGHOST>(a, idx, z4c.alpha, m,k,j,i);
+    d.ddchi_dd(a,a) = Dxx<NGHOST>(a, idx, z4c.chi,   m,k,j,i);
+
+    for(int b = a + 1; b < 3; ++b) {
+      d.ddalpha_dd(a,b) = Dxy<NGHOST>(a, b, idx, z4c.alpha, m,k,j,i);
+      d.ddchi_dd(a,b) = Dxy<NGHOST>(a, b, idx, z4c.chi,   m,k,j,i);
+    }
+  }
+
+  // Vectors
+  for(int c = 0; c < 3; ++c)
+  for(int a = 0; a < 3; ++a) {
+    d.ddbeta_ddu(a,a,c) = Dxx<NGHOST>(a, idx, z4c.beta_u, m,c,k,j,i);
+    for(int b = a + 1; b < 3; ++b) {
+      d.ddbeta_ddu(a,b,c) = Dxy<NGHOST>(a, b, idx, z4c.beta_u, m,c,k,j,i);
+    }
+  }
+
+  // Tensors
+  for(int c = 0; c < 3; ++c)
+  for(int e = c; e < 3; ++e)
+  for(int a = 0; a < 3; ++a) {
+    d.ddg_dddd(a,a,c,e) = Dxx<NGHOST>(a, idx, z4c.g_dd, m,c,e,k,j,i);
+    for(int b = a + 1; b < 3; ++b) {
+      d.ddg_dddd(a,b,c,e) = Dxy<NGHOST>(a, b, idx, z4c.g_dd, m,c,e,k,j,i);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4cAdvectDerivs
+//! \brief advective derivatives of the Z4c variables along the shift
+
+template <int NGHOST, typename Z4cT>
+KOKKOS_INLINE_FUNCTION
+void Z4cAdvectDerivs(const Real idx[], const Z4cT &z4c,
+                     const int m, const int k, const int j, const int i, Z4cDerivs &d) {
+  d.Lalpha = 0.0;
+  d.Lchi = 0.0;
+  d.LKhat = 0.0;
+  d.LTheta = 0.0;
+  d.Lbeta_u.ZeroClear();
+  d.LGam_u.ZeroClear();
+  d.Lg_dd.ZeroClear();
+  d.LA_dd.ZeroClear();
+
+  //
+  // Scalars
+  for(int a = 0; a < 3; ++a) {
+    d.Lalpha += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.alpha, m,a,k,j,i);
+    d.Lchi   += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.chi,   m,a,k,j,i);
+    d.LKhat  += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vKhat,  m,a,k,j,i);
+    d.LTheta += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vTheta, m,a,k,j,i);
+  }
+
+  //
+  // Vectors
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    d.Lbeta_u(b) += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.beta_u, m,a,b,k,j,i);
+    d.LGam_u(b)  += Lx<NGHOST>(a, idx, z4c.beta_u, z4c.vGam_u,  m,a,b,k,j,i);
+  }
+
+  //
+  // Tensors
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b)
+  for(int c = 0; c < 3; ++c) {
+    d.Lg_dd(a,b) += Lx<NGHOST>(c, idx, z4c.beta_u, z4c.g_dd, m,c,a,b,k,j,i);
+    d.LA_dd(a,b) += Lx<NGHOST>(c, idx, z4c.beta_u, z4c.vA_dd, m,c,a,b,k,j,i);
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4cAssembleRHS
+//! \brief computes the curvature, matter and gauge terms at a point from the derivatives
+//! in d, and stores the RHS of the Z4c equations.  Note the Lie derivatives in d are
+//! finalized (modified) in place.
+
+template <typename Z4cT>
+KOKKOS_INLINE_FUNCTION
+void Z4cAssembleRHS(const Z4c::Options &opt, const bool is_vacuum,
+                    const Tmunu::Tmunu_vars &tmunu, const Z4cT &z4c,
+                    const Z4c::Z4c_vars &rhs,
+                    const int m, const int k, const int j, const int i, Z4cDerivs &d) {
+  // Gamma computed from the metric
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> Gamma_u;
+  // Covariant derivative of A
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> DA_u;
+
+  // inverse of conf. metric
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> g_uu;
+  // inverse of A
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> A_uu;
+  // g^cd A_ac A_db
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> AA_dd;
+  // Ricci tensor
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> R_dd;
+  // Ricci tensor, conformal contribution
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> Rphi_dd;
+  // 2nd differential of the lapse
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> Ddalpha_dd;
+  // 2nd differential of phi
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 2> Ddphi_dd;
+
+  // Christoffel symbols of 1st kind
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 3> Gamma_ddd;
+  // Christoffel symbols of 2nd kind
+  AthenaPointTensor<Real, TensorSymm::SYM2, 3, 3> Gamma_udd;
+
+  // 2nd "divergence" of beta
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> ddbeta_d;
+  // phi 1st drvts
+  AthenaPointTensor<Real, TensorSymm::NONE, 3, 1> dphi_d;
+
+  // -----------------------------------------------------------------------------------
+  // Initialize everything to zero
+  //
+  // Scalars
+
+  // determinant of three metric
+  Real detg = 0.0;
+  // bounded version of chi
+  Real chi_guarded = 0.0;
+  // 1/psi4
+  Real oopsi4 = 0.0;
+  // trace of A
+  Real AA = 0.0;
+  // Ricci scalar
+  Real R = 0.0;
+  // tilde H
+  Real Ht = 0.0;
+  // trace of extrinsic curvature
+  Real K = 0.0;
+  // Trace of S_ik
+  Real S = 0.0;
+  // Trace of Ddalpha_dd
+  Real Ddalpha = 0.0;
+
+  // d_a beta^a
+  Real dbeta = 0.0;
+
+  //
+  // Vectors
+  Gamma_u.ZeroClear();
+  DA_u.ZeroClear();
+  ddbeta_d.ZeroClear();
+
+  //
+  // Symmetric tensors
+  AA_dd.ZeroClear();
+  R_dd.ZeroClear();
+  A_uu.ZeroClear();
+  Gamma_udd.ZeroClear();
+
+  // -----------------------------------------------------------------------------------
+  // Get K from Khat
+  //
+  K = z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i);
+
+  // -----------------------------------------------------------------------------------
+  // Inverse metric
+
+  detg = adm::SpatialDet(z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i),
+                            z4c.g_dd(m,0,2,k,j,i), z4c.g_dd(m,1,1,k,j,i),
+                            z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i));
+  adm::SpatialInv(1.0/detg,
+             z4c.g_dd(m,0,0,k,j,i), z4c.g_dd(m,0,1,k,j,i), z4c.g_dd(m,0,2,k,j,i),
+             z4c.g_dd(m,1,1,k,j,i), z4c.g_dd(m,1,2,k,j,i), z4c.g_dd(m,2,2,k,j,i),
+             &g_uu(0,0), &g_uu(0,1), &g_uu(0,2),
+             &g_uu(1,1), &g_uu(1,2), &g_uu(2,2));
+
+  // -----------------------------------------------------------------------------------
+  // Christoffel symbols
+
+  for(int c = 0; c < 3; ++c)
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    Gamma_ddd(c,a,b) = 0.5*(d.dg_ddd(a,b,c) + d.dg_ddd(b,a,c) - d.dg_ddd(c,a,b));
+  }
+  for(int c = 0; c < 3; ++c)
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b)
+  for(int e = 0; e < 3; ++e) {
+    Gamma_udd(c,a,b) += g_uu(c,e)*Gamma_ddd(e,a,b);
+  }
+  // Gamma's computed from the conformal metric (not evolved)
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b)
+  for(int c = 0; c < 3; ++c) {
+    Gamma_u(a) += g_uu(b,c)*Gamma_udd(a,b,c);
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Curvature of conformal metric
+  //
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    for(int c = 0; c < 3; ++c) {
+      R_dd(a,b) += 0.5*(z4c.g_dd(m,c,a,k,j,i)*d.dGam_du(b,c) +
+                        z4c.g_dd(m,c,b,k,j,i)*d.dGam_du(a,c) +
+                        Gamma_u(c)*(Gamma_ddd(a,b,c) + Gamma_ddd(b,a,c)));
+    }
+    for(int c = 0; c < 3; ++c)
+    for(int e = 0; e < 3; ++e) {
+      R_dd(a,b) -= 0.5*g_uu(c,e)*d.ddg_dddd(c,e,a,b);
+    }
+    for(int c = 0; c < 3; ++c)
+    for(int e = 0; e < 3; ++e)
+    for(int f = 0; f < 3; ++f) {
+      R_dd(a,b) += g_uu(c,e)*(
+          Gamma_udd(f,c,a)*Gamma_ddd(b,f,e) +
+          Gamma_udd(f,c,b)*Gamma_ddd(a,f,e) +
+          Gamma_udd(f,a,e)*Gamma_ddd(f,c,b));
+    }
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Derivatives of conformal factor phi
+  //
+  chi_guarded = (z4c.chi(m,k,j,i)>opt.chi_div_floor)
+                  ? z4c.chi(m,k,j,i) : opt.chi_div_floor;
+  oopsi4 = pow(chi_guarded, -4./opt.chi_psi_power);
+  for(int a = 0; a < 3; ++a) {
+    dphi_d(a) = d.dchi_d(a)/(chi_guarded * opt.chi_psi_power);
+  }
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    Ddphi_dd(a,b) = d.ddchi_dd(a,b)/(chi_guarded * opt.chi_psi_power) -
+      opt.chi_psi_power * dphi_d(a) * dphi_d(b);
+    for(int c = 0; c < 3; ++c) {
+      Ddphi_dd(a,b) -= Gamma_udd(c,a,b)*dphi_d(c);
+    }
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Curvature contribution from conformal factor
+  //
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    Rphi_dd(a,b) = 4.*dphi_d(a)*dphi_d(b) - 2.*Ddphi_dd(a,b);
+    for(int c = 0; c < 3; ++c)
+    for(int e = 0; e < 3; ++e) {
+      Rphi_dd(a,b) -= 2.*z4c.g_dd(m,a,b,k,j,i) * g_uu(c,e)*(Ddphi_dd(c,e) +
+          2.*dphi_d(c)*dphi_d(e));
+    }
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Trace of the matter stress tensor
+  //
+  if(!is_vacuum) {
+    for (int a = 0; a < 3; ++a)
+    for (int b = 0; b < 3; ++b) {
+      S += oopsi4 * g_uu(a,b) * tmunu.S_dd(m,a,b,k,j,i);
+    }
+  }
+
+  // -----------------------------------------------------------------------------------
+  // 2nd covariant derivative of the lapse
+  // TODO(JMF): This could potentially be sped up by calculating d_i phi d^i alpha
+  // beforehand.
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    Ddalpha_dd(a,b) = d.ddalpha_dd(a,b)
+                     - 2.*(dphi_d(a)*d.dalpha_d(b) + dphi_d(b)*d.dalpha_d(a));
+    for(int c = 0; c < 3; ++c) {
+      Ddalpha_dd(a,b) -= Gamma_udd(c,a,b)*d.dalpha_d(c);
+      for(int e = 0; e < 3; ++e) {
+          Ddalpha_dd(a,b) += 2.*z4c.g_dd(m,a,b,k,j,i) * g_uu(c,e)
+          * dphi_d(c) * d.dalpha_d(e);
+      }
+    }
+  }
+
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    Ddalpha += oopsi4 * g_uu(a,b) * Ddalpha_dd(a,b);
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Contractions of A_ab, inverse, and derivatives
+  //
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b)
+  for(int c = 0; c < 3; ++c)
+  for(int e = 0; e < 3; ++e) {
+    AA_dd(a,b) += g_uu(c,e) * z4c.vA_dd(m,a,c,k,j,i) * z4c.vA_dd(m,e,b,k,j,i);
+  }
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    AA += g_uu(a,b) * AA_dd(a,b);
+  }
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b)
+  for(int c = 0; c < 3; ++c)
+  for(int e = 0; e < 3; ++e) {
+    A_uu(a,b) += g_uu(a,c) * g_uu(b,e) * z4c.vA_dd(m,c,e,k,j,i);
+  }
+  // TODO(JMF): dchi_d/chi_guarded is opt.chi_psi_power * dphi_d.
+  for(int a = 0; a < 3; ++a) {
+    for(int b = 0; b < 3; ++b) {
+        DA_u(a) -= (3./2.) * A_uu(a,b) * d.dchi_d(b) / chi_guarded;
+        DA_u(a) -= (1./3.) * g_uu(a,b) * (2.*d.dKhat_d(b) + d.dTheta_d(b));
+    }
+    for(int b = 0; b < 3; ++b)
+    for(int c = 0; c < 3; ++c) {
+      DA_u(a) += Gamma_udd(a,b,c) * A_uu(b,c);
+    }
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Ricci scalar
+  //
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    R += oopsi4 * g_uu(a,b) * (R_dd(a,b) + Rphi_dd(a,b));
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Hamiltonian constraint
+  //
+  // Note that the matter term is *not* included here; this is included explicitly when
+  // calculating d_t \Theta.
+  Ht = R + (2./3.)*SQR(K) - AA;// - 16.*M_PI*tmunu.E(m,k,j,i);
+
+  // -----------------------------------------------------------------------------------
+  // Finalize advective (Lie) derivatives
+  //
+  // Shift vector contractions
+  for(int a = 0; a < 3; ++a) {
+    dbeta += d.dbeta_du(a,a);
+  }
+  for(int a = 0; a < 3; ++a)
+  for(int b = 0; b < 3; ++b) {
+    ddbeta_d(a) += (1./3.) * d.ddbeta_ddu(a,b,b);
+  }
+
+  // Finalize Lchi
+  d.Lchi += (1./6.) * opt.chi_psi_power * chi_guarded * dbeta;
+
+  // Finalize LGam_u (note that this is not a real Lie derivative)
+  for(int a = 0; a < 3; ++a) {
+    d.LGam_u(a) += (2./3.) * Gamma_u(a) * dbeta;
+    for(int b = 0; b < 3; ++b) {
+      d.LGam_u(a) += g_uu(a,b) * ddbeta_d(b) - Gamma_u(b) * d.dbeta_du(b,a);
+      for(int c = 0; c < 3; ++c) {
+        d.LGam_u(a) += g_uu(b,c) * d.ddbeta_ddu(b,c,a);
+      }
+    }
+  }
+
+  // Finalize Lg_dd and LA_dd
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    d.Lg_dd(a,b) -= (2./3.) * z4c.g_dd(m,a,b,k,j,i) * dbeta;
+    for(int c = 0; c < 3; ++c) {
+      d.Lg_dd(a,b) += d.dbeta_du(a,c) * z4c.g_dd(m,b,c,k,j,i);
+      d.Lg_dd(a,b) += d.dbeta_du(b,c) * z4c.g_dd(m,a,c,k,j,i);
+    }
+  }
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    d.LA_dd(a,b) -= (2./3.) * z4c.vA_dd(m,a,b,k,j,i) * dbeta;
+    for(int c = 0; c < 3; ++c) {
+      d.LA_dd(a,b) += d.dbeta_du(b,c) * z4c.vA_dd(m,a,c,k,j,i);
+      d.LA_dd(a,b) += d.dbeta_du(a,c) * z4c.vA_dd(m,b,c,k,j,i);
+    }
+  }
+
+  // -----------------------------------------------------------------------------------
+  // Assemble RHS
+  //
+  // Khat, chi, and Theta
+  rhs.vKhat(m,k,j,i) = - Ddalpha + z4c.alpha(m,k,j,i)
+    * (AA + (1./3.)*SQR(K)) +
+    d.LKhat + opt.damp_kappa1*(1 - opt.damp_kappa2)
+    * z4c.alpha(m,k,j,i) * z4c.vTheta(m,k,j,i);
+  // Matter term
+  if(!is_vacuum) {
+    rhs.vKhat(m,k,j,i) += 4.*M_PI * z4c.alpha(m,k,j,i) * (S + tmunu.E(m,k,j,i));
+  }
+  rhs.chi(m,k,j,i) = d.Lchi - (1./6.) * opt.chi_psi_power *
+    chi_guarded * z4c.alpha(m,k,j,i) * K;
+  rhs.vTheta(m,k,j,i) = d.LTheta + z4c.alpha(m,k,j,i) * (
+      0.5*Ht - (2. + opt.damp_kappa2) * opt.damp_kappa1 * z4c.vTheta(m,k,j,i));
+  // Matter term
+  if(!is_vacuum) {
+    rhs.vTheta(m,k,j,i) -= 8.*M_PI * z4c.alpha(m,k,j,i) * tmunu.E(m,k,j,i);
+  }
+  // If BSSN is enabled, theta is disabled.
+  rhs.vTheta(m,k,j,i) *= opt.use_z4c;
+  // Gamma's
+  for(int a = 0; a < 3; ++a) {
+    rhs.vGam_u(m,a,k,j,i) = 2.*z4c.alpha(m,k,j,i)*DA_u(a) + d.LGam_u(a);
+    rhs.vGam_u(m,a,k,j,i) -= 2.*z4c.alpha(m,k,j,i) * opt.damp_kappa1 *
+        (z4c.vGam_u(m,a,k,j,i) - Gamma_u(a));
+    for(int b = 0; b < 3; ++b) {
+      rhs.vGam_u(m,a,k,j,i) -= 2. * A_uu(a,b) * d.dalpha_d(b);
+      // Matter term
+      if(!is_vacuum) {
+        rhs.vGam_u(m,a,k,j,i) -= 16.*M_PI * z4c.alpha(m,k,j,i)
+                            * g_uu(a,b) * tmunu.S_d(m,b,k,j,i);
+      }
+    }
+  }
+
+  // g and A
+  for(int a = 0; a < 3; ++a)
+  for(int b = a; b < 3; ++b) {
+    rhs.g_dd(m,a,b,k,j,i) = - 2. * z4c.alpha(m,k,j,i) * z4c.vA_dd(m,a,b,k,j,i)
+                    + d.Lg_dd(a,b);
+    rhs.vA_dd(m,a,b,k,j,i) = oopsi4 *
+        (-Ddalpha_dd(a,b) + z4c.alpha(m,k,j,i) * (R_dd(a,b) + Rphi_dd(a,b)));
+    rhs.vA_dd(m,a,b,k,j,i) -= (1./3.) * z4c.g_dd(m,a,b,k,j,i)
+                           * (-Ddalpha + z4c.alpha(m,k,j,i)*R);
+    rhs.vA_dd(m,a,b,k,j,i) += z4c.alpha(m,k,j,i) * (K*z4c.vA_dd(m,a,b,k,j,i)
+                           - 2.*AA_dd(a,b));
+    rhs.vA_dd(m,a,b,k,j,i) += d.LA_dd(a,b);
+    // Matter term
+    if(!is_vacuum) {
+      rhs.vA_dd(m,a,b,k,j,i) -= 8.*M_PI * z4c.alpha(m,k,j,i) *
+              (oopsi4*tmunu.S_dd(m,a,b,k,j,i) - (1./3.)*S*z4c.g_dd(m,a,b,k,j,i));
+    }
+  }
+  // lapse function
+  Real const f = opt.lapse_oplog * opt.lapse_harmonicf
+               + opt.lapse_harmonic * z4c.alpha(m,k,j,i);
+  rhs.alpha(m,k,j,i) = opt.lapse_advect * d.Lalpha
+                     - f * z4c.alpha(m,k,j,i) * z4c.vKhat(m,k,j,i);
+
+  // shift vector
+  for(int a = 0; a < 3; ++a) {
+    rhs.beta_u(m,a,k,j,i) = opt.shift_ggamma * z4c.vGam_u(m,a,k,j,i)
+                          + opt.shift_advect * d.Lbeta_u(a);
+    rhs.beta_u(m,a,k,j,i) -= opt.shift_eta * z4c.beta_u(m,a,k,j,i);
+    // FORCE beta = 0
+    //rhs.beta_u(m,a,k,j,i) = 0;
+  }
+
+  // harmonic gauge terms
+  for(int a = 0; a < 3; ++a) {
+    rhs.beta_u(m,a,k,j,i) += opt.shift_alpha2ggamma *
+                        SQR(z4c.alpha(m,k,j,i)) * z4c.vGam_u(m,a,k,j,i);
+    for(int b = 0; b < 3; ++b) {
+      rhs.beta_u(m,a,k,j,i) += opt.shift_hh * z4c.alpha(m,k,j,i) *
+        chi_guarded * (0.5 * z4c.alpha(m,k,j,i) * d.dchi_d(b) - d.dalpha_d(b))
+        * g_uu(a,b);
+    }
+  }
+}
+
+} // namespace z4c
+#endif // Z4C_Z4C_CALCRHS_HPP_
@@ -189,22 +189,24 @@ TaskStatus Z4c::RecvU(Driver *pdrive, int stage) {
 
 //----------------------------------------------------------------------------------------
 //! \fn  void Z4c::EnforceAlgConstr
-//! \brief
+//! \brief Apply the algebraic constraints.  With the fused update the interior has
+//! already been constrained in ExpRKUpdate, so only the ghost zones are updated here.
 
 TaskStatus Z4c::EnforceAlgConstr(Driver *pdrive, int stage) {
   if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
-    AlgConstr(pmy_pack);
+    AlgConstr(pmy_pack, opt.fused_update && stage > 0);
   }
   return TaskStatus::complete;
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn  void Z4c::ADMToZ4c_
-//! \brief
+//! \fn  void Z4c::ConvertZ4cToADM
+//! \brief Compute the ADM variables.  With the fused update the interior has already been
+//! converted in ExpRKUpdate, so only the ghost zones are updated here.
 
 TaskStatus Z4c::ConvertZ4cToADM(Driver *pdrive, int stage) {
   if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
-    Z4cToADM(pmy_pack);
+    Z4cToADM(pmy_pack, opt.fused_update && stage > 0);
   }
   return TaskStatus::complete;
 }
@@ -6,13 +6,16 @@
 //! \file z4c_update.cpp
 //! \brief Performs update of z4c variables (u0) for each stage of explicit
 //  SSP RK integrators (e.g. RK1, RK2, RK3, RK4). Update uses weighted average
-//  and partial time step appropriate to stage.
+//  and partial time step appropriate to stage.  With <z4c>/fused_update the algebraic
+//  constraints and the conversion to ADM variables are applied in the same kernel.
 
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "driver/driver.hpp"
 #include "coordinates/coordinates.hpp"
+#include "coordinates/adm.hpp"
 #include "z4c/z4c.hpp"
+#include "z4c/z4c_update.hpp"
 
 namespace z4c {
 //----------------------------------------------------------------------------------------
@@ -34,6 +37,41 @@ TaskStatus Z4c::ExpRKUpdate(Driver *pdriver, int stage) {
   int nmb1 = pmy_pack->nmb_thispack - 1;
   int nvar = nz4c;
 
+  // Fused update: update all variables in each cell, then apply the algebraic constraints
+  // and compute the ADM variables from the values held in registers, so that u0, u1 and
+  // u_rhs are each read once and the separate AlgConstr and Z4cToADM passes only have to
+  // process the ghost zones.
+  if (opt.fused_update) {
+    bool constrain = (pmy_pack->pdyngr != nullptr || stage == pdriver->nexp_stages);
+    auto &adm = pmy_pack->padm->adm;
+    Real chi_psi_power = opt.chi_psi_power;
+    par_for("z4c fused RK update",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+      Real u[nz4c];  // NOLINT(runtime/arrays)
+      for (int n = 0; n < nz4c; ++n) {
+        u[n] = gam0*u0(m,n,k,j,i) + gam1*u1(m,n,k,j,i) + beta_dt*u_rhs(m,n,k,j,i);
+      }
+      if (constrain) {
+        Z4cAlgConstrPoint(&u[I_Z4C_GXX], &u[I_Z4C_AXX]);
+      }
+      for (int n = 0; n < nz4c; ++n) {
+        u0(m,n,k,j,i) = u[n];
+      }
+      if (constrain) {
+        Real adm_g_dd[6], adm_K_dd[6];
+        Z4cToADMPoint(chi_psi_power, u[I_Z4C_CHI], u[I_Z4C_KHAT], u[I_Z4C_THETA],
+                      &u[I_Z4C_GXX], &u[I_Z4C_AXX], adm.psi4(m,k,j,i),
+                      adm_g_dd, adm_K_dd);
+        for(int a = 0, ab = 0; a < 3; ++a)
+        for(int b = a; b < 3; ++b, ++ab) {
+          adm.g_dd(m,a,b,k,j,i) = adm_g_dd[ab];
+          adm.vK_dd(m,a,b,k,j,i) = adm_K_dd[ab];
+        }
+      }
+    });
+    return TaskStatus::complete;
+  }
+
   par_for("z4c RK update",DevExeSpace(),
       0,nmb1,0,nvar-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
@@ -0,0 +1,65 @@
+#ifndef Z4C_Z4C_UPDATE_HPP_
+#define Z4C_Z4C_UPDATE_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file z4c_update.hpp
+//! \brief Pointwise operations applied to the Z4c variables after each update: the
+//! algebraic constraint projection and the conversion to ADM variables.  They are shared
+//! by Z4c::AlgConstr and Z4c::Z4cToADM, and by the fused kernel in Z4c::ExpRKUpdate.
+//! Symmetric tensors are stored as arrays of 6 in the order xx, xy, xz, yy, yz, zz (the
+//! same order as in u0).
+
+#include <math.h>
+
+#include "athena.hpp"
+#include "coordinates/adm.hpp"
+
+namespace z4c {
+//----------------------------------------------------------------------------------------
+//! \fn void Z4cAlgConstrPoint(Real g_dd[6], Real A_dd[6])
+//! \brief enforce det(g) = 1 and tr(A) = 0 on the conformal metric and tracefree
+//! extrinsic curvature in a single cell
+
+KOKKOS_INLINE_FUNCTION
+void Z4cAlgConstrPoint(Real g_dd[6], Real A_dd[6]) {
+  Real detg = adm::SpatialDet(g_dd[0], g_dd[1], g_dd[2], g_dd[3], g_dd[4], g_dd[5]);
+  detg = detg > 0. ? detg : 1.;
+  Real oopsi4 = std::cbrt(1./detg);
+
+  for (int ab = 0; ab < 6; ++ab) {
+    g_dd[ab] *= oopsi4;
+  }
+
+  // compute trace of A
+  // note: here we are assuming that det g = 1, which we enforced above
+  Real A = adm::Trace(1.0, g_dd[0], g_dd[1], g_dd[2], g_dd[3], g_dd[4], g_dd[5],
+                           A_dd[0], A_dd[1], A_dd[2], A_dd[3], A_dd[4], A_dd[5]);
+
+  // enforce trace of A to be zero
+  for (int ab = 0; ab < 6; ++ab) {
+    A_dd[ab] -= (1.0/3.0) * A * g_dd[ab];
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Z4cToADMPoint()
+//! \brief compute ADM psi4, g_ij and K_ij from the Z4c variables in a single cell
+
+KOKKOS_INLINE_FUNCTION
+void Z4cToADMPoint(const Real chi_psi_power, const Real chi, const Real Khat,
+                   const Real Theta, const Real g_dd[6], const Real A_dd[6],
+                   Real &psi4, Real adm_g_dd[6], Real adm_K_dd[6]) {
+  psi4 = pow(chi, 4./chi_psi_power);
+  for (int ab = 0; ab < 6; ++ab) {
+    adm_g_dd[ab] = psi4 * g_dd[ab];
+  }
+  for (int ab = 0; ab < 6; ++ab) {
+    adm_K_dd[ab] = psi4 * A_dd[ab] + (1./3.) * (Khat + 2.*Theta) * adm_g_dd[ab];
+  }
+}
+
+} // namespace z4c
+#endif // Z4C_Z4C_UPDATE_HPP_
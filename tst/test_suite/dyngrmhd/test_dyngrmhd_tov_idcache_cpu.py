@@ -0,0 +1,64 @@
+"""
+Test of the initial data cache (<problem>/id_cache_dir) using the TOV star problem
+generator.  The TOV pgen is not part of the built-in pgens, so it is compiled in a
+separate build directory.
+
+The first run misses the cache, computes the initial data and writes one snapshot per
+MeshBlock.  The second run must read the initial data from the cache, and give results
+that are bitwise identical to the first run.
+"""
+
+# Modules
+import os
+import shutil
+import pytest
+import test_suite.testutils as testutils
+
+_repo = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", "..", ".."))
+_build = os.path.join(_repo, "tst", "build_tov")
+_cache = "tov_idcache"
+_input = "inputs/tov_dyngrmhd.athinput"
+
+
+def run_tov(name):
+    """Run TOV star, return contents of history file and output written to log."""
+    with open(testutils.LOG_FILE_PATH) as f:
+        f.seek(0, os.SEEK_END)
+        start = f.tell()
+    command = [os.path.join(_build, "src", "athena"), "-i", _input,
+               f"job/basename={name}", f"problem/id_cache_dir={_cache}"]
+    assert testutils.run_command(command), f"Failed to run {name}"
+    with open(testutils.LOG_FILE_PATH) as f:
+        f.seek(start)
+        log = f.read()
+    with open(f"{name}.mhd.hst") as f:
+        hst = f.read()
+    return hst, log
+
+
+def test_run():
+    """Build TOV pgen, run twice and check second run reads initial data from cache."""
+    try:
+        assert testutils.run_command(
+            ["cmake", "-S", _repo, "-B", _build, "-D", "PROBLEM=dyngr_tov"]
+        ), "CMake configuration failed"
+        assert testutils.run_command(
+            ["make", "-C", _build, "-j", f"{os.cpu_count()}"]
+        ), "Make command failed"
+        shutil.rmtree(_cache, ignore_errors=True)
+
+        hst_miss, log = run_tov("tov_miss")
+        assert "Initial data cache miss" in log
+        assert os.path.isfile(os.path.join(_cache, os.listdir(_cache)[0], "meta.bin"))
+
+        hst_hit, log = run_tov("tov_hit")
+        assert "Initial data read from cache" in log
+        if hst_hit != hst_miss:
+            pytest.fail("History with cached initial data differs from original run")
+    finally:
+        shutil.rmtree(_cache, ignore_errors=True)
+        shutil.rmtree(_build, ignore_errors=True)
+        testutils.cleanup()
+        for f in os.listdir("."):
+            if f.startswith("tov_") and f.endswith(".hst"):
+                os.remove(f)
@@ -0,0 +1,40 @@
+"""
+Test of the cached metric (<coord>/cache_metric) using the GR Bondi accretion problem.
+Runs the test in 3D with SMR with and without the cache, and checks that the errors
+agree to round-off (the metric is computed by the same functions in both cases, but
+compilers may contract operations differently in the two kernels).
+"""
+
+# Modules
+import numpy as np
+import pytest
+import test_suite.testutils as testutils
+import athena_read
+
+input_file = "inputs/gr_bondi.athinput"
+
+
+def arguments(cache):
+    """Assemble arguments for run command"""
+    return [
+        "job/basename=gr_bondi",
+        "time/tlim=5.0",
+        "time/integrator=rk2",
+        "hydro/reconstruct=plm",
+        "coord/cache_metric=" + cache,
+    ]
+
+
+def test_run():
+    """Run with and without cached metric and compare errors."""
+    try:
+        for cache in ["false", "true"]:
+            results = testutils.run(input_file, arguments(cache))
+            assert results, f"GR Bondi test run failed for cache_metric={cache}."
+        data = athena_read.error_dat("gr_bondi-errs.dat")
+        if not np.allclose(data[0][4:], data[1][4:], rtol=1.0e-10, atol=0.0):
+            pytest.fail(
+                f"Errors with cached metric differ, errors: {data[0][4:]} {data[1][4:]}"
+            )
+    finally:
+        testutils.cleanup()
@@ -0,0 +1,92 @@
+"""
+Test of the exact integration of ISM cooling (<hydro_srcterms>/cooling_integrator=exact)
+in a uniform medium.  First cools gas from 10^7 K, where the cooling function is a
+piecewise power law and the integration is exact, and compares with an explicit run
+using a much smaller timestep.  Then includes heating, so that the gas cools below
+10^4.2 K into thermal equilibrium using the subcycled implicit fallback, and checks the
+equilibrium temperature and that the fallback is reported in the event log.
+"""
+
+# Modules
+import math
+import os
+import pytest
+import test_suite.testutils as testutils
+import athena_read
+
+input_file = "inputs/cooling.athinput"
+
+# unit conversions for <units> block in input file
+_length = 3.0857e18
+_mass = 4.9e31
+_time = 3.156e13
+_amu = 1.660538921e-24
+_kboltz = 1.3806488e-16
+_gm1 = 0.66666666667
+_temp_unit = (_length / _time) ** 2 * _amu / _kboltz
+_n_unit = _mass / _length**3 / _amu
+
+
+def arguments(name, integrator, cfl, hrate, tlim):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        f"hydro_srcterms/cooling_integrator={integrator}",
+        f"hydro_srcterms/hrate={hrate}",
+        f"time/cfl_number={cfl}",
+        f"time/tlim={tlim}",
+    ]
+
+
+def final_temperature(name):
+    """Temperature [K] at end of run from history file"""
+    data = athena_read.hst(f"{name}.hydro.hst")
+    return data["tot-E"][-1] * _gm1 / data["mass"][-1] * _temp_unit
+
+
+def fallback_count(name):
+    """Total number of cells integrated with fallback, from event log"""
+    with open(f"{name}.log") as f:
+        lines = f.readlines()
+    header = lines[1].split()[1:]
+    icol = header.index("cool_fb")
+    return sum(int(ln.split()[icol]) for ln in lines[2:])
+
+
+def test_run():
+    """Run exact and explicit cooling and compare."""
+    try:
+        # pure cooling from 10^7 K
+        results = testutils.run(input_file, arguments("cool_exact", "exact", 0.4,
+                                                      0.0, 0.01))
+        assert results, "Exact cooling run failed."
+        results = testutils.run(input_file, arguments("cool_expl", "explicit", 0.01,
+                                                      0.0, 0.01))
+        assert results, "Explicit cooling run failed."
+        t_exact = final_temperature("cool_exact")
+        t_expl = final_temperature("cool_expl")
+        if abs(t_exact / t_expl - 1.0) > 1.0e-4:
+            pytest.fail(f"Exact cooling T={t_exact:g} differs from explicit T={t_expl:g}")
+        if fallback_count("cool_exact") != 0:
+            pytest.fail("Fallback used for T > 10^4.2 K without heating")
+
+        # cooling and heating into thermal equilibrium below 10^4.2 K
+        hrate = 2.0e-26
+        results = testutils.run(input_file, arguments("cool_heat", "exact", 0.4,
+                                                      hrate, 0.5))
+        assert results, "Exact cooling run with heating failed."
+        temp = final_temperature("cool_heat")
+        lam = (2.0e-19 * math.exp(-1.184e5 / (temp + 1.0e3))
+               + 2.8e-28 * math.sqrt(temp) * math.exp(-92.0 / temp))
+        nden = 100.0 * _n_unit
+        if abs(nden * lam / hrate - 1.0) > 1.0e-2:
+            pytest.fail(f"Gas not in thermal equilibrium, T={temp:g}, "
+                        f"n*Lambda/Gamma={nden * lam / hrate:g}")
+        if fallback_count("cool_heat") == 0:
+            pytest.fail("Fallback not reported in event log")
+    finally:
+        for name in ["cool_exact", "cool_expl", "cool_heat"]:
+            for ext in [".hydro.hst", ".log"]:
+                if os.path.exists(name + ext):
+                    os.remove(name + ext)
+        testutils.cleanup()
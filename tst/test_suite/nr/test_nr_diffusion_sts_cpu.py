@@ -0,0 +1,44 @@
+"""
+Test of super-time-stepping (<time>/sts_integrator=rkl2) of viscosity, resistivity, and
+thermal conduction in MHD.  Diffuses a shear layer, current sheet, and contact
+discontinuity, and compares the solution with one in which the diffusion terms are
+integrated explicitly.  Also checks that with STS the timestep is not limited by the
+diffusion terms.
+"""
+
+# Modules
+import numpy as np
+import pytest
+import test_suite.testutils as testutils
+import athena_read
+
+input_file = "inputs/diffusion.athinput"
+
+
+def arguments(name, sts):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        f"time/sts_integrator={sts}",
+    ]
+
+
+def test_run():
+    """Run with and without STS and compare."""
+    try:
+        data = {}
+        for sts in ["none", "rkl2"]:
+            name = "diff_" + sts
+            results = testutils.run(input_file, arguments(name, sts))
+            assert results, f"Diffusion test run failed for sts_integrator={sts}."
+            data[sts] = athena_read.tab(f"tab/{name}.mhd_w_bcc.00001.tab")
+        expl, sts = data["none"], data["rkl2"]
+        for var in ["dens", "eint", "vely", "bcc2"]:
+            err = np.abs(sts[var] - expl[var]).mean()
+            if err > 2.0e-4:
+                pytest.fail(f"STS and explicit solutions differ in {var}, L1 err={err:g}")
+        if sts["cycle"] > expl["cycle"] / 3:
+            pytest.fail(f"STS run took {sts['cycle']} cycles, explicit run "
+                        f"{expl['cycle']} cycles")
+    finally:
+        testutils.cleanup()
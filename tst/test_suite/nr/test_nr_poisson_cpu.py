@@ -0,0 +1,66 @@
+"""
+Test of the multigrid Poisson solver used for self-gravity.  Solves for the potential of
+a sinusoidal density in 2D and 3D, and checks the errors converge at second order, that
+each V-cycle reduces the defect by a large factor, and that the solver converges with
+static mesh refinement and Dirichlet boundaries.
+"""
+
+# Modules
+import numpy as np
+import pytest
+import test_suite.testutils as testutils
+
+input_file = "inputs/poisson.athinput"
+errs_file = "Poisson-errs.dat"
+
+
+def arguments(nx, dim=2, bc="periodic"):
+    """Assemble arguments for run command"""
+    args = [f"mesh/nx1={nx}", f"mesh/nx2={nx}", "mesh/nx3=1", "meshblock/nx3=1"]
+    if dim == 3:
+        args[2:] = [f"mesh/nx3={nx}", "meshblock/nx3=16"]
+    if bc != "periodic":
+        args += ["problem/d0=0.0"]
+        for d in range(1, dim + 1):
+            args += [f"mesh/ix{d}_bc={bc}", f"mesh/ox{d}_bc={bc}"]
+    return args
+
+
+def read_errs():
+    """Read the error file written by the problem generator, one row per run"""
+    return np.atleast_2d(np.loadtxt(errs_file))
+
+
+def test_convergence():
+    """Check second-order convergence and V-cycle efficiency in 2D and 3D."""
+    try:
+        for dim, res in [(2, [32, 64]), (3, [16, 32])]:
+            for nx in res:
+                results = testutils.run(input_file, arguments(nx, dim))
+                assert results, f"Poisson test run failed for {dim}D, nx={nx}."
+        data = read_errs()
+        for row in range(0, 4, 2):
+            ratio = data[row, 7] / data[row + 1, 7]
+            if ratio < 3.5:
+                pytest.fail(f"L1 error ratio {ratio:g} not second order, row {row}")
+        if np.any(data[:, 5] > 0.3):
+            pytest.fail(f"V-cycle convergence factor too large: {data[:, 5]}")
+    finally:
+        testutils.cleanup()
+
+
+def test_smr_and_dirichlet():
+    """Check the solver converges with a refined region and with u=0 boundaries."""
+    try:
+        smr = ["mesh_refinement/refinement=static"]
+        results = testutils.run(input_file, arguments(64) + smr)
+        assert results, "Poisson test run failed with SMR."
+        results = testutils.run(input_file, arguments(64, bc="outflow"))
+        assert results, "Poisson test run failed with Dirichlet BCs."
+        data = read_errs()
+        if np.any(data[:, 5] > 0.3):
+            pytest.fail(f"V-cycle convergence factor too large: {data[:, 5]}")
+        if np.any(data[:, 7] > 1.0e-5):
+            pytest.fail(f"L1 errors too large: {data[:, 7]}")
+    finally:
+        testutils.cleanup()
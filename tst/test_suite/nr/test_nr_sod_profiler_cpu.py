@@ -0,0 +1,71 @@
+"""
+Test of the TaskList profiler (<profiler> block) using the Sod shocktube.
+Runs the test with the profiler enabled, and checks that the per-rank summary table and
+the Chrome trace are written and contain one completed call of each hydro Task per stage
+and cycle.
+"""
+
+# Modules
+import glob
+import json
+import os
+import pytest
+import test_suite.testutils as testutils
+
+input_file = "inputs/sod.athinput"
+_nlim = 10
+_nstages = 2
+_tasks = ["Hydro::CopyCons", "Hydro::Fluxes", "Hydro::RKUpdate", "Hydro::ConToPrim"]
+
+
+def arguments():
+    """Assemble arguments for run command"""
+    return [
+        "job/basename=sod_prof",
+        "time/nlim=" + repr(_nlim),
+        "time/integrator=rk2",
+        "output1/dt=-1",
+        "profiler/enable=true",
+    ]
+
+
+def test_run():
+    """Run with profiler and check summary table and trace."""
+    try:
+        results = testutils.run(input_file, arguments())
+        assert results, "Sod shocktube run with profiler failed."
+
+        # summary table: one line per (TaskList, stage, Task)
+        with open("sod_prof.rank_00000000.prof") as f:
+            lines = f.readlines()
+        for task in _tasks:
+            rows = [ln.split() for ln in lines if f" {task} " in ln]
+            if len(rows) != _nstages:
+                pytest.fail(f"{task} not found once per stage in profile: {rows}")
+            for row in rows:
+                if int(row[3]) != _nlim:
+                    pytest.fail(f"{task} completed {row[3]} times, expected {_nlim}")
+
+        # trace: complete events for each Task, nested inside the TaskList events
+        with open("sod_prof.rank_00000000.trace.json") as f:
+            trace = json.load(f)
+        events = [ev for ev in trace["traceEvents"] if ev["ph"] == "X"]
+        for task in _tasks:
+            calls = [ev for ev in events if ev["name"] == task
+                     and ev["args"]["status"] == "complete"]
+            if len(calls) != _nstages * _nlim:
+                pytest.fail(f"{len(calls)} trace events for {task}, "
+                            f"expected {_nstages * _nlim}")
+        stagen = [ev for ev in events if ev["name"] == "stagen"]
+        if len(stagen) != _nstages * _nlim:
+            pytest.fail(f"{len(stagen)} trace events for stagen TaskList")
+        for ev in events:
+            if ev["cat"] == "stagen" and ev["name"] != "stagen":
+                parent = [p for p in stagen if p["ts"] <= ev["ts"]
+                          and ev["ts"] + ev["dur"] <= p["ts"] + p["dur"] + 1.0e-3]
+                if len(parent) != 1:
+                    pytest.fail(f"Task event {ev} not nested in a stagen event")
+    finally:
+        for f in glob.glob("sod_prof.rank_*"):
+            os.remove(f)
+        testutils.cleanup()
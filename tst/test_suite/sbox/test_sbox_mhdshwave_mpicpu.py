@@ -82,9 +82,10 @@ def compute_error(data):
     return (np.abs(data["dByc"] - dbyc)).mean()
 
 
-def arguments(res):
+def arguments(res, remap):
     """Assemble arguments for run command"""
     return [
+        "shearing_box/orbital_remap=" + remap,
         "job/basename=shwave4",
         "mesh/nx1=" + repr(res),
         "mesh/nx2=" + repr(res),
@@ -98,13 +99,15 @@ def arguments(res):
 errors = {}
 
 
-def test_run():
-    """Loop over resolutions and run test with given reconstruction/flux."""
+@pytest.mark.parametrize("remap", ["flux", "spectral"])
+def test_run(remap):
+    """Loop over resolutions and run test with given orbital advection remap method."""
     try:
         for res in _res:
             # set number of threads to number of MeshBlocks
             nthreads = 8 if res == 32 else 1
-            results = testutils.mpi_run(input_file, arguments(res), threads=nthreads)
+            results = testutils.mpi_run(input_file, arguments(res, remap),
+                                        threads=nthreads)
             assert results, f"MHD shwave test run failed for {res}."
             data = athena_read.hst("shwave4.user.hst")
             errors[res] = compute_error(data)
@@ -0,0 +1,48 @@
+"""
+Test of the fused Z4c update (<z4c>/fused_update).
+Runs the quasi-2D linear wave problem with AMR using the unfused and the fused update
+(with both the pointwise and the tiled RHS), and checks the errors agree to round-off.
+The fused path constrains the interior before restriction and communication, so the
+two paths are not bitwise identical, and errors in components that vanish analytically
+are only compared against an absolute tolerance.
+"""
+
+# Modules
+import numpy as np
+import pytest
+import test_suite.testutils as testutils
+import athena_read
+
+input_file = "inputs/lwave_z4c.athinput"
+
+
+def arguments(fused, tiled):
+    """Assemble arguments for run command"""
+    return [
+        "mesh/nx1=32",
+        "mesh/nx2=32",
+        "mesh/nx3=4",
+        "meshblock/nx1=8",
+        "meshblock/nx2=8",
+        "meshblock/nx3=4",
+        "time/nlim=10",
+        "z4c/fused_update=" + fused,
+        "z4c/rhs_tiled=" + tiled,
+    ]
+
+
+def test_run():
+    """Run unfused and fused updates and compare errors."""
+    try:
+        for fused, tiled in [("false", "false"), ("true", "false"), ("true", "true")]:
+            results = testutils.run(input_file, arguments(fused, tiled))
+            assert results, f"Z4c linear wave run failed for fused_update={fused}."
+        data = athena_read.error_dat("z4c_lin_wave-errs.dat")
+        for row in data[1:]:
+            if not np.allclose(data[0][4:], row[4:], rtol=1.0e-6, atol=1.0e-15):
+                pytest.fail(
+                    f"Fused Z4c update differs from unfused update, "
+                    f"errors: {data[0][4:]} {row[4:]}"
+                )
+    finally:
+        testutils.cleanup()
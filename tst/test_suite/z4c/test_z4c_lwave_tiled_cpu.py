@@ -0,0 +1,45 @@
+"""
+Test of the cache-blocked Z4c RHS kernel (<z4c>/rhs_tiled).
+Runs the quasi-2D linear wave problem with AMR using the pointwise and the tiled RHS,
+with tiles that do not evenly divide the MeshBlocks, and checks the errors agree to
+round-off (the two kernels may differ in how the compiler fuses operations).
+"""
+
+# Modules
+import numpy as np
+import pytest
+import test_suite.testutils as testutils
+import athena_read
+
+input_file = "inputs/lwave_z4c.athinput"
+
+
+def arguments(tiled):
+    """Assemble arguments for run command"""
+    return [
+        "mesh/nx1=32",
+        "mesh/nx2=32",
+        "mesh/nx3=4",
+        "meshblock/nx1=8",
+        "meshblock/nx2=8",
+        "meshblock/nx3=4",
+        "time/nlim=10",
+        "z4c/rhs_tiled=" + tiled,
+        "z4c/rhs_tile_nx1=3",
+    ]
+
+
+def test_run():
+    """Run pointwise and tiled RHS and compare errors."""
+    try:
+        for tiled in ["false", "true"]:
+            results = testutils.run(input_file, arguments(tiled))
+            assert results, f"Z4c linear wave run failed for rhs_tiled={tiled}."
+        data = athena_read.error_dat("z4c_lin_wave-errs.dat")
+        if not np.allclose(data[0][4:], data[1][4:], rtol=1.0e-6, atol=0.0):
+            pytest.fail(
+                f"Tiled Z4c RHS differs from pointwise RHS, "
+                f"errors: {data[0][4:]} {data[1][4:]}"
+            )
+    finally:
+        testutils.cleanup()